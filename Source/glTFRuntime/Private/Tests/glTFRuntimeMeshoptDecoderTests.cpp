@@ -0,0 +1,261 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+* The fast EXT_meshopt_compression decoders (and filters) must produce the same bytes of the
+* original byte by byte implementation (DecompressMeshOptimizerReference).
+* Bitstreams cover every byte group mode (with escapes), multiple vertex blocks and every triangle code.
+*/
+
+// 45 elements, stride 12
+static const uint8 glTFRuntimeMeshoptTestAttributes[] =
+{
+	0xa0, 0x27, 0x24, 0xc4, 0x5a, 0x1b, 0x7b, 0x24, 0xfd, 0x1f, 0xf7, 0xe6, 0x78, 0x6e, 0x3b, 0x0d,
+	0x48, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x36, 0x07, 0x76, 0xb7, 0x9e, 0x35, 0x13, 0xa5, 0x1c, 0x1a,
+	0x2e, 0x2e, 0x2c, 0xd2, 0x39, 0x24, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf0, 0x00, 0x54, 0xd8,
+	0xc2, 0x62, 0xe0, 0x2a, 0x99, 0x14, 0x8c, 0xea, 0x3d, 0x49, 0x1f, 0x10, 0x01, 0x01, 0x01, 0x00,
+	0x02, 0x00, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00,
+	0x00, 0x02, 0x02, 0x02, 0x01, 0x00, 0x01, 0x00, 0x02, 0x01, 0x04, 0x81, 0x5a, 0x90, 0x00, 0x0e,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x5c, 0x78, 0xf7, 0x66, 0x4d, 0xc1, 0x95, 0x4b, 0x60, 0x9f,
+	0x64, 0x86, 0x00, 0xa6, 0x12, 0x46, 0xff, 0xff, 0xff, 0xff, 0x04, 0x4a, 0xb2, 0x92, 0x7e, 0x3a,
+	0x63, 0xb0, 0x97, 0x83, 0xdc, 0xa7, 0xa5, 0xad, 0xc4, 0x09, 0xff, 0xf8, 0xff, 0xff, 0xf0, 0xff,
+	0xf0, 0x00, 0xeb, 0x8c, 0x45, 0xee, 0xbc, 0x1d, 0x41, 0x35, 0xb7, 0x57, 0x80, 0x1f, 0x29, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00,
+	0x00, 0x00, 0x02, 0x01, 0x01, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x02, 0x89, 0x61,
+	0x0a, 0x40, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x97, 0x04, 0x17, 0x99, 0x21, 0x04, 0xc1,
+	0xee, 0x1f, 0x58, 0xb2, 0x68, 0xab, 0xae, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x85, 0x7b, 0x1f,
+	0xf4, 0xab, 0xf9, 0xf6, 0x2f, 0x40, 0x17, 0x33, 0x30, 0x59, 0xcc, 0x5f, 0x3d, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xa0, 0x00, 0x52, 0x97, 0x65, 0x88, 0xf7, 0xb4, 0x55, 0x92, 0x60, 0xdd, 0x51,
+	0xeb, 0x1f, 0xdb, 0x02, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x02, 0x01,
+	0x00, 0x00, 0x98, 0x00, 0x04, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 300 elements, stride 4
+static const uint8 glTFRuntimeMeshoptTestOctahedral8[] =
+{
+	0xa0, 0xe7, 0x76, 0x6e, 0xe7, 0xbe, 0x09, 0x07, 0x0e, 0x02, 0x11, 0x04, 0x03, 0x03, 0x0d, 0x0c,
+	0x10, 0x09, 0x10, 0x01, 0x08, 0xcf, 0xfb, 0xff, 0xff, 0x10, 0x04, 0x0e, 0x0b, 0x03, 0x12, 0x03,
+	0x03, 0x0d, 0x03, 0x0f, 0x0d, 0x03, 0x0c, 0xff, 0xcc, 0x5b, 0x48, 0xff, 0x23, 0x5a, 0x81, 0x10,
+	0x12, 0x0f, 0x0f, 0x03, 0x0a, 0x0b, 0x10, 0x0d, 0x07, 0x0c, 0x05, 0x0f, 0x06, 0x06, 0x0a, 0x08,
+	0x0c, 0x05, 0x05, 0xff, 0xff, 0xe7, 0xe7, 0xd6, 0xfa, 0xde, 0x01, 0x12, 0x0f, 0x0f, 0x12, 0x12,
+	0x9f, 0xff, 0xbf, 0xfc, 0x09, 0x0a, 0x0d, 0x0a, 0x0b, 0x10, 0x09, 0x0d, 0x04, 0x07, 0x10, 0x0c,
+	0x0b, 0x01, 0x0b, 0x09, 0x00, 0x02, 0x01, 0x0c, 0x0f, 0x08, 0x0f, 0x02, 0x01, 0x0a, 0x08, 0x11,
+	0xff, 0xff, 0xff, 0xfb, 0x0d, 0x10, 0x04, 0x10, 0x08, 0x0f, 0x04, 0x04, 0x03, 0x04, 0x08, 0x03,
+	0x07, 0x11, 0x03, 0x76, 0xc5, 0x43, 0xf6, 0x11, 0xef, 0xf1, 0xff, 0x11, 0x10, 0x11, 0x12, 0x0f,
+	0x08, 0x02, 0x0e, 0x06, 0x05, 0x0f, 0x11, 0x10, 0x04, 0x0d, 0x02, 0x00, 0x00, 0x02, 0x00, 0x09,
+	0x87, 0x0f, 0x05, 0xfa, 0xac, 0x70, 0x23, 0x39, 0x10, 0x12, 0xff, 0x0f, 0xff, 0xfc, 0x0f, 0x0c,
+	0x0a, 0x12, 0x09, 0x0b, 0x03, 0x0e, 0x0f, 0x03, 0x0a, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x04, 0x01, 0x0d, 0x03, 0x02, 0x10, 0x09, 0x03, 0x09, 0x0d, 0x08, 0xff, 0xfc, 0xfd, 0xc0, 0x10,
+	0x08, 0x05, 0x06, 0x11, 0x06, 0x11, 0x08, 0x10, 0x0c, 0x04, 0x00, 0x0d, 0x97, 0x12, 0xa2, 0x11,
+	0xcc, 0x0d, 0x11, 0x05, 0x09, 0x09, 0x0b, 0x05, 0x01, 0x07, 0x07, 0x0b, 0x11, 0x12, 0x06, 0x0d,
+	0x03, 0x00, 0x76, 0x6e, 0xe7, 0x76, 0xf4, 0xff, 0xcb, 0x0f, 0xfd, 0xd9, 0xc7, 0xe5, 0x42, 0x10,
+	0x11, 0x0f, 0x12, 0xff, 0xff, 0xff, 0xb7, 0x05, 0x06, 0x0a, 0x0a, 0x03, 0x0d, 0x11, 0x10, 0x12,
+	0x11, 0x0f, 0x0d, 0x0e, 0x05, 0x09, 0x12, 0x03, 0x08, 0x0b, 0x08, 0x08, 0x0a, 0x0b, 0x06, 0x0b,
+	0x05, 0x10, 0x09, 0x07, 0x0a, 0xff, 0xff, 0xf4, 0xf3, 0x0d, 0x10, 0x0f, 0x11, 0x03, 0x08, 0x0c,
+	0x06, 0x07, 0x11, 0x10, 0x09, 0x0f, 0xf2, 0xfc, 0xef, 0xdd, 0x3b, 0x3f, 0x8f, 0x25, 0x10, 0x0f,
+	0x0f, 0x0f, 0x12, 0x03, 0x06, 0x00, 0x02, 0x11, 0x12, 0x0d, 0x05, 0x01, 0x04, 0x03, 0x00, 0x0a,
+	0x00, 0x11, 0x00, 0x9b, 0xf1, 0x55, 0xe1, 0xd1, 0xf9, 0x7f, 0xfb, 0x10, 0x11, 0x10, 0x10, 0xff,
+	0xcf, 0xff, 0xfd, 0x09, 0x0f, 0x12, 0x09, 0x09, 0x0f, 0x05, 0x0b, 0x10, 0x09, 0x07, 0x08, 0x07,
+	0x08, 0x0b, 0x0f, 0x03, 0x0a, 0x00, 0x03, 0x05, 0x02, 0x0d, 0x04, 0x06, 0x02, 0x0b, 0x07, 0x01,
+	0x0b, 0xff, 0x7f, 0xef, 0xff, 0x04, 0x08, 0x0b, 0x12, 0x08, 0x0e, 0x05, 0x08, 0x0b, 0x0e, 0x08,
+	0x06, 0x10, 0x05, 0x6f, 0x6f, 0x08, 0x2a, 0x5c, 0xde, 0xd0, 0x5f, 0x12, 0x11, 0x11, 0x03, 0x0d,
+	0x08, 0x05, 0x0c, 0x03, 0x11, 0x08, 0x07, 0x0a, 0x10, 0x0b, 0x09, 0x0e, 0x02, 0x0e, 0xf7, 0xa3,
+	0xe3, 0xa0, 0x12, 0xd9, 0x65, 0x82, 0x10, 0xff, 0xff, 0xff, 0xef, 0x0a, 0x0f, 0x08, 0x12, 0x12,
+	0x0c, 0x04, 0x06, 0x10, 0x03, 0x03, 0x08, 0x11, 0x07, 0x09, 0x11, 0x12, 0x11, 0x08, 0x0a, 0x0f,
+	0x06, 0x05, 0x02, 0x06, 0x08, 0x0d, 0x11, 0x0f, 0x03, 0x0f, 0xff, 0xff, 0x33, 0xff, 0x03, 0x11,
+	0x03, 0x0c, 0x12, 0x0a, 0x04, 0x0b, 0x12, 0x06, 0x05, 0x12, 0x0b, 0x0b, 0x6e, 0xe4, 0x46, 0x6e,
+	0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x46, 0x6e, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xf4, 0x8d, 0x28, 0xb4, 0x97, 0x1c, 0x81, 0x31, 0x12, 0xfb,
+	0xf5, 0xff, 0xff, 0x03, 0x12, 0x0c, 0x07, 0x05, 0x10, 0x0e, 0x0d, 0x08, 0x10, 0x0c, 0x0a, 0x0d,
+	0x03, 0x03, 0x12, 0x0c, 0x0e, 0x08, 0x02, 0x04, 0x00, 0x03, 0x05, 0x0b, 0x00, 0x00, 0x00, 0x00,
+	0x39, 0xff, 0xff, 0xff, 0xef, 0x0f, 0x10, 0x04, 0x0e, 0x11, 0x0c, 0x08, 0x0a, 0x08, 0x0e, 0x10,
+	0x0a, 0x12, 0x0d, 0x0a, 0xa6, 0xf2, 0xc4, 0x21, 0xf5, 0x3c, 0x3c, 0xf0, 0x11, 0x11, 0x11, 0x06,
+	0x00, 0x04, 0x10, 0x04, 0x10, 0x04, 0x01, 0x01, 0x0b, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 elements, stride 8
+static const uint8 glTFRuntimeMeshoptTestOctahedral16[] =
+{
+	0xa0, 0x07, 0x6b, 0xd2, 0x73, 0x0c, 0x00, 0xac, 0xfc, 0xe1, 0x0a, 0x89, 0xbe, 0x1e, 0x0c, 0xbd,
+	0xa4, 0x05, 0xff, 0xff, 0x00, 0x00, 0xa7, 0xc2, 0xcd, 0x5e, 0x27, 0xdd, 0xbe, 0x08, 0x06, 0xf9,
+	0x68, 0x03, 0xb7, 0xbf, 0xa5, 0xf3, 0xf8, 0xfa, 0x15, 0x13, 0x0f, 0xfd, 0xff, 0x00, 0x00, 0x15,
+	0x05, 0x08, 0x13, 0x06, 0x11, 0x08, 0x07, 0xa6, 0x68, 0x42, 0x4a, 0xc0, 0xfe, 0x7b, 0x57, 0x17,
+	0x1f, 0xa8, 0x87, 0x05, 0xcd, 0x9d, 0xdf, 0xff, 0xff, 0x00, 0x00, 0xb3, 0x9a, 0xc0, 0x5c, 0xb8,
+	0x23, 0x34, 0xb3, 0x0b, 0x7a, 0x09, 0x05, 0x0e, 0x10, 0x11, 0x03, 0x00, 0x03, 0x16, 0x0f, 0x13,
+	0x0c, 0x14, 0x12, 0x0f, 0xc8, 0x4b, 0x7f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x01, 0x40,
+	0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 elements, stride 8
+static const uint8 glTFRuntimeMeshoptTestQuaternion[] =
+{
+	0xa0, 0x07, 0x80, 0x54, 0x18, 0x2a, 0x4f, 0x53, 0xcd, 0xca, 0x1d, 0x18, 0x3e, 0xe7, 0xb2, 0x64,
+	0x7d, 0x0c, 0xff, 0xff, 0x00, 0x00, 0xc6, 0x8d, 0x9f, 0x95, 0xfe, 0x1f, 0x5e, 0xd6, 0x0a, 0xfa,
+	0x5b, 0x1a, 0x80, 0x51, 0x4e, 0xf4, 0x67, 0x64, 0x10, 0xd1, 0x2d, 0x8c, 0x67, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x7c, 0x62, 0xe7, 0x3a, 0x39, 0x2a, 0xe7, 0x8d, 0x19, 0x24, 0x4c, 0x0e, 0xc8, 0xdf,
+	0xf8, 0x11, 0xff, 0xff, 0x00, 0x00, 0x9d, 0xca, 0x97, 0x37, 0x93, 0xe6, 0x27, 0x6b, 0x0a, 0xf2,
+	0xd4, 0x26, 0x0e, 0xc5, 0xd8, 0x87, 0xd9, 0x82, 0x90, 0x17, 0x51, 0x7a, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x67, 0xbe, 0x50, 0xd6, 0x8d, 0x67, 0x8c, 0x8a, 0xcb, 0x92, 0x1d, 0x73, 0xf9, 0xd6, 0x99,
+	0x08, 0xff, 0xff, 0x00, 0x00, 0x74, 0x6e, 0x4f, 0x67, 0xde, 0xa6, 0x0f, 0x4f, 0x0a, 0xff, 0x78,
+	0x47, 0x31, 0x42, 0x4b, 0x95, 0x92, 0x9e, 0x10, 0xf6, 0x55, 0x6d, 0xea, 0x00, 0x00, 0x00, 0x00,
+	0x0f, 0x06, 0x54, 0x52, 0x02, 0x11, 0x02, 0x20, 0x25, 0x61, 0x98, 0xcd, 0x00, 0x00, 0x05, 0x06,
+	0x01, 0xc0, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 24 elements, stride 12
+static const uint8 glTFRuntimeMeshoptTestExponential[] =
+{
+	0xa0, 0x07, 0x52, 0x2a, 0x31, 0x63, 0x26, 0x1d, 0x38, 0xdf, 0x4c, 0x73, 0x71, 0xe1, 0xe8, 0x54,
+	0x6d, 0x0d, 0xff, 0xff, 0x00, 0x00, 0xa6, 0xd0, 0x3a, 0xbb, 0x22, 0xc1, 0xb1, 0x8e, 0x07, 0x7c,
+	0xb6, 0xa6, 0x76, 0x95, 0x25, 0xdd, 0xcc, 0xf0, 0x19, 0x55, 0x84, 0x87, 0x20, 0xc4, 0xc0, 0xff,
+	0xff, 0x00, 0x00, 0x56, 0x75, 0xdd, 0xe1, 0xe1, 0xcd, 0x2e, 0x84, 0x07, 0xe5, 0x0e, 0x90, 0xac,
+	0x13, 0xd4, 0x52, 0x3f, 0x9a, 0x53, 0x6d, 0x35, 0xc1, 0x81, 0x86, 0x06, 0xff, 0xff, 0x00, 0x00,
+	0xce, 0xa5, 0x5c, 0xf6, 0xd7, 0xdc, 0x4b, 0x2d, 0x06, 0x70, 0x0e, 0xff, 0xd6, 0xff, 0x4f, 0xf3,
+	0xf3, 0x13, 0x18, 0x17, 0x1c, 0x1b, 0x1a, 0x17, 0xff, 0xf7, 0x00, 0x00, 0x22, 0x05, 0x0d, 0x0a,
+	0x11, 0x14, 0x0a, 0x07, 0xd7, 0x31, 0x53, 0x28, 0x8f, 0x1e, 0x99, 0x8a, 0x0c, 0x10, 0x15, 0x4c,
+	0x3b, 0xfe, 0xe4, 0x06, 0xff, 0xff, 0x00, 0x00, 0xdc, 0x4e, 0x92, 0x76, 0x7c, 0xcf, 0xf5, 0x6e,
+	0x07, 0x6a, 0x9f, 0x8e, 0xf6, 0x0e, 0xd0, 0xff, 0xb5, 0x4d, 0xe2, 0xbe, 0x1d, 0x6a, 0xe5, 0xda,
+	0xa3, 0xff, 0xff, 0x00, 0x00, 0xf9, 0x1e, 0xb7, 0x18, 0x03, 0xde, 0x5e, 0xb9, 0x07, 0x15, 0xf6,
+	0x21, 0x69, 0xa6, 0x60, 0x59, 0x8d, 0xeb, 0x6e, 0xac, 0xfc, 0xad, 0xd4, 0x9a, 0x98, 0xff, 0xff,
+	0x00, 0x00, 0x9f, 0x5f, 0x50, 0xe0, 0x51, 0x0e, 0x5b, 0x93, 0x06, 0xf6, 0xf9, 0x02, 0x3b, 0x4f,
+	0xff, 0xf1, 0x27, 0x13, 0x1a, 0x0f, 0x22, 0x1b, 0x14, 0xff, 0xdf, 0x00, 0x00, 0x04, 0x09, 0x09,
+	0x1c, 0x17, 0x10, 0x0f, 0x07, 0x4a, 0x81, 0xde, 0x6b, 0x13, 0xb2, 0x85, 0x10, 0xe1, 0x37, 0xa4,
+	0x2b, 0xd8, 0x3e, 0xde, 0x04, 0xff, 0xff, 0x00, 0x00, 0x5d, 0x28, 0x0d, 0xf6, 0xef, 0x50, 0xb6,
+	0x57, 0x07, 0xc1, 0x67, 0x98, 0x51, 0xf4, 0x64, 0x9c, 0x69, 0x05, 0x6b, 0x1d, 0xc6, 0xb8, 0x34,
+	0x33, 0x51, 0xff, 0xff, 0x00, 0x00, 0xff, 0x19, 0x38, 0x69, 0x59, 0xed, 0xfa, 0xb5, 0x07, 0xeb,
+	0x4f, 0x98, 0x0e, 0xcf, 0x97, 0xd6, 0x13, 0x03, 0x81, 0x57, 0x44, 0x31, 0x6d, 0x86, 0xb8, 0xf7,
+	0xff, 0x00, 0x00, 0x45, 0x06, 0x33, 0xbf, 0xc8, 0x98, 0xf6, 0x06, 0xc3, 0x19, 0x12, 0xe3, 0xb7,
+	0x5f, 0x02, 0x0f, 0x1a, 0x17, 0xef, 0xfd, 0x00, 0x00, 0x1a, 0x05, 0x15, 0x07, 0x10, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 144 elements
+static const uint8 glTFRuntimeMeshoptTestTriangles[] =
+{
+	0xe1, 0xfe, 0xfe, 0x40, 0x6e, 0x1f, 0x3e, 0x90, 0x30, 0xfe, 0x8e, 0x8b, 0x5f, 0x7f, 0xff, 0x1f,
+	0xfb, 0x1d, 0xce, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xfe, 0x7d, 0xfe, 0x6f, 0xff, 0xb7, 0xfe, 0x0f,
+	0x20, 0xf9, 0xbe, 0x70, 0xfe, 0x1f, 0xf9, 0xfe, 0x5d, 0xdd, 0xfe, 0xff, 0x2d, 0xfb, 0x8e, 0xfe,
+	0xc0, 0x00, 0x11, 0x01, 0x00, 0x03, 0xda, 0x03, 0x8f, 0x36, 0x0f, 0xa2, 0x05, 0xf2, 0xc6, 0x04,
+	0xf2, 0x02, 0x80, 0x69, 0x20, 0x86, 0x04, 0x0f, 0xe4, 0x03, 0x9a, 0x01, 0x00, 0x00, 0xe8, 0x04,
+	0xf0, 0x3b, 0xf0, 0x01, 0x30, 0x1b, 0xff, 0xa4, 0x02, 0xc0, 0x03, 0xd8, 0x8a, 0x01, 0x00, 0x0f,
+	0x9a, 0x01, 0x08, 0xa2, 0x02, 0x00, 0x00, 0x10, 0x01, 0x12, 0x21, 0x13, 0x31, 0x20, 0x02, 0x23,
+	0x32, 0x14, 0x41, 0x15, 0x51, 0x00,
+};
+
+class FglTFRuntimeMeshoptTestParser : public FglTFRuntimeParser
+{
+public:
+	FglTFRuntimeMeshoptTestParser() : FglTFRuntimeParser(MakeShared<FJsonObject>(), FMatrix::Identity, 1)
+	{
+	}
+
+	using FglTFRuntimeParser::DecompressMeshOptimizer;
+	using FglTFRuntimeParser::DecompressMeshOptimizerReference;
+};
+
+struct FglTFRuntimeMeshoptTestCase
+{
+	const uint8* Data;
+	int64 Num;
+	int64 Elements;
+	int64 Stride;
+	const TCHAR* Mode;
+	const TCHAR* Filter;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeMeshoptDecoderTest, "glTFRuntime.MeshoptDecoder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeMeshoptDecoderTest::RunTest(const FString& Parameters)
+{
+	const FglTFRuntimeMeshoptTestCase TestCases[] =
+	{
+		{ glTFRuntimeMeshoptTestAttributes, sizeof(glTFRuntimeMeshoptTestAttributes), 45, 12, TEXT("ATTRIBUTES"), TEXT("NONE") },
+		{ glTFRuntimeMeshoptTestOctahedral8, sizeof(glTFRuntimeMeshoptTestOctahedral8), 300, 4, TEXT("ATTRIBUTES"), TEXT("NONE") },
+		{ glTFRuntimeMeshoptTestOctahedral8, sizeof(glTFRuntimeMeshoptTestOctahedral8), 300, 4, TEXT("ATTRIBUTES"), TEXT("OCTAHEDRAL") },
+		{ glTFRuntimeMeshoptTestOctahedral16, sizeof(glTFRuntimeMeshoptTestOctahedral16), 24, 8, TEXT("ATTRIBUTES"), TEXT("OCTAHEDRAL") },
+		{ glTFRuntimeMeshoptTestQuaternion, sizeof(glTFRuntimeMeshoptTestQuaternion), 24, 8, TEXT("ATTRIBUTES"), TEXT("QUATERNION") },
+		{ glTFRuntimeMeshoptTestExponential, sizeof(glTFRuntimeMeshoptTestExponential), 24, 12, TEXT("ATTRIBUTES"), TEXT("EXPONENTIAL") },
+		{ glTFRuntimeMeshoptTestTriangles, sizeof(glTFRuntimeMeshoptTestTriangles), 144, 2, TEXT("TRIANGLES"), TEXT("NONE") },
+		{ glTFRuntimeMeshoptTestTriangles, sizeof(glTFRuntimeMeshoptTestTriangles), 144, 4, TEXT("TRIANGLES"), TEXT("NONE") },
+	};
+
+	TSharedRef<FglTFRuntimeMeshoptTestParser> Parser = MakeShared<FglTFRuntimeMeshoptTestParser>();
+
+	for (const FglTFRuntimeMeshoptTestCase& TestCase : TestCases)
+	{
+		const FString Name = FString::Printf(TEXT("%s %s (stride %lld)"), TestCase.Mode, TestCase.Filter, TestCase.Stride);
+
+		FglTFRuntimeBlob Blob;
+		Blob.Data = const_cast<uint8*>(TestCase.Data);
+		Blob.Num = TestCase.Num;
+
+		TArray64<uint8> Bytes;
+		if (!TestTrue(*FString::Printf(TEXT("%s decoded"), *Name), Parser->DecompressMeshOptimizer(Blob, TestCase.Stride, TestCase.Elements, TestCase.Mode, TestCase.Filter, Bytes)))
+		{
+			continue;
+		}
+
+		TArray64<uint8> ReferenceBytes;
+		if (!TestTrue(*FString::Printf(TEXT("%s decoded by the reference"), *Name), Parser->DecompressMeshOptimizerReference(Blob, TestCase.Stride, TestCase.Elements, TestCase.Mode, TestCase.Filter, ReferenceBytes)))
+		{
+			continue;
+		}
+
+		if (!TestEqual(*FString::Printf(TEXT("%s size"), *Name), Bytes.Num(), ReferenceBytes.Num()))
+		{
+			continue;
+		}
+
+		for (int64 Index = 0; Index < Bytes.Num(); Index++)
+		{
+			if (Bytes[Index] != ReferenceBytes[Index])
+			{
+				AddError(FString::Printf(TEXT("%s differs at byte %lld (%u, expected %u)"), *Name, Index, Bytes[Index], ReferenceBytes[Index]));
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -4,6 +4,53 @@
 #include "glTFAnimBoneCompressionCodec.h"
 #include "Runtime/Launch/Resources/Version.h"
 
+typedef TArray<float, TInlineAllocator<1024>> FglTFRuntimePoseScratch;
+
+static void glTFRuntimeLerpPoseKeys(const float* RESTRICT KeysA, const float* RESTRICT KeysB, float* RESTRICT Out, const int32 Num, const float Alpha)
+{
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		Out[Index] = KeysA[Index] + (KeysB[Index] - KeysA[Index]) * Alpha;
+	}
+}
+
+// normalized lerp (shortest path) of all of the tracks rotations
+static void glTFRuntimeNlerpPoseKeys(const float* RESTRICT KeysA, const float* RESTRICT KeysB, float* RESTRICT Out, const int32 NumTracks, const float Alpha)
+{
+	const float* RESTRICT AX = KeysA;
+	const float* RESTRICT AY = KeysA + NumTracks;
+	const float* RESTRICT AZ = KeysA + NumTracks * 2;
+	const float* RESTRICT AW = KeysA + NumTracks * 3;
+	const float* RESTRICT BX = KeysB;
+	const float* RESTRICT BY = KeysB + NumTracks;
+	const float* RESTRICT BZ = KeysB + NumTracks * 2;
+	const float* RESTRICT BW = KeysB + NumTracks * 3;
+	float* RESTRICT OutX = Out;
+	float* RESTRICT OutY = Out + NumTracks;
+	float* RESTRICT OutZ = Out + NumTracks * 2;
+	float* RESTRICT OutW = Out + NumTracks * 3;
+
+	const float AlphaA = 1.0f - Alpha;
+
+	for (int32 Index = 0; Index < NumTracks; Index++)
+	{
+		const float Dot = AX[Index] * BX[Index] + AY[Index] * BY[Index] + AZ[Index] * BZ[Index] + AW[Index] * BW[Index];
+		const float AlphaB = Dot >= 0 ? Alpha : -Alpha;
+
+		const float X = AX[Index] * AlphaA + BX[Index] * AlphaB;
+		const float Y = AY[Index] * AlphaA + BY[Index] * AlphaB;
+		const float Z = AZ[Index] * AlphaA + BZ[Index] * AlphaB;
+		const float W = AW[Index] * AlphaA + BW[Index] * AlphaB;
+
+		const float InvLength = 1.0f / FMath::Sqrt(FMath::Max(X * X + Y * Y + Z * Z + W * W, SMALL_NUMBER));
+
+		OutX[Index] = X * InvLength;
+		OutY[Index] = Y * InvLength;
+		OutZ[Index] = Z * InvLength;
+		OutW[Index] = W * InvLength;
+	}
+}
+
 void UglTFAnimBoneCompressionCodec::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
 {
 	OutAtom.SetLocation(GetTrackLocation(DecompContext, TrackIndex));
@@ -64,20 +111,156 @@ FVector UglTFAnimBoneCompressionCodec::GetTrackScale(FAnimSequenceDecompressionC
 
 void UglTFAnimBoneCompressionCodec::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
 {
-	for (const BoneTrackPair& BoneTrackPair : RotationPairs)
+	if (PoseNumKeys == 0 || PoseNumTracks != Tracks.Num())
 	{
-		OutAtoms[BoneTrackPair.AtomIndex].SetRotation(GetTrackRotation(DecompContext, BoneTrackPair.TrackIndex));
+		for (const BoneTrackPair& BoneTrackPair : RotationPairs)
+		{
+			OutAtoms[BoneTrackPair.AtomIndex].SetRotation(GetTrackRotation(DecompContext, BoneTrackPair.TrackIndex));
+		}
+
+		for (const BoneTrackPair& BoneTrackPair : TranslationPairs)
+		{
+			OutAtoms[BoneTrackPair.AtomIndex].SetLocation(GetTrackLocation(DecompContext, BoneTrackPair.TrackIndex));
+		}
+
+		for (const BoneTrackPair& BoneTrackPair : ScalePairs)
+		{
+			OutAtoms[BoneTrackPair.AtomIndex].SetScale3D(GetTrackScale(DecompContext, BoneTrackPair.TrackIndex));
+		}
+		return;
 	}
 
-	for (const BoneTrackPair& BoneTrackPair : TranslationPairs)
+	// all of the tracks share the same keys, so frames and alpha are computed only once
+	int32 FrameA = 0;
+	int32 FrameB = 0;
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION > 0
+	const float Alpha = TimeToIndex(DecompContext.GetPlayableLength(), DecompContext.GetRelativePosition(), PoseNumKeys, DecompContext.Interpolation, FrameA, FrameB);
+#else
+	const float Alpha = TimeToIndex(DecompContext.SequenceLength, DecompContext.RelativePos, PoseNumKeys, DecompContext.Interpolation, FrameA, FrameB);
+#endif
+
+	const bool bInterpolate = Alpha > 0 && FrameA != FrameB;
+	const int32 NumTracks = PoseNumTracks;
+
+	if (RotationPairs.Num() > 0)
 	{
-		OutAtoms[BoneTrackPair.AtomIndex].SetLocation(GetTrackLocation(DecompContext, BoneTrackPair.TrackIndex));
+		const float* Rotations = PoseRotations.GetData() + FrameA * NumTracks * 4;
+		FglTFRuntimePoseScratch InterpolatedRotations;
+		if (bInterpolate)
+		{
+			InterpolatedRotations.SetNumUninitialized(NumTracks * 4);
+			glTFRuntimeNlerpPoseKeys(Rotations, PoseRotations.GetData() + FrameB * NumTracks * 4, InterpolatedRotations.GetData(), NumTracks, Alpha);
+			Rotations = InterpolatedRotations.GetData();
+		}
+
+		for (const BoneTrackPair& BoneTrackPair : RotationPairs)
+		{
+			const int32 TrackIndex = BoneTrackPair.TrackIndex;
+			OutAtoms[BoneTrackPair.AtomIndex].SetRotation(FQuat(Rotations[TrackIndex], Rotations[NumTracks + TrackIndex], Rotations[NumTracks * 2 + TrackIndex], Rotations[NumTracks * 3 + TrackIndex]));
+		}
 	}
 
-	for (const BoneTrackPair& BoneTrackPair : ScalePairs)
+	if (TranslationPairs.Num() > 0)
 	{
-		OutAtoms[BoneTrackPair.AtomIndex].SetScale3D(GetTrackScale(DecompContext, BoneTrackPair.TrackIndex));
+		const float* Locations = PoseLocations.GetData() + FrameA * NumTracks * 3;
+		FglTFRuntimePoseScratch InterpolatedLocations;
+		if (bInterpolate)
+		{
+			InterpolatedLocations.SetNumUninitialized(NumTracks * 3);
+			glTFRuntimeLerpPoseKeys(Locations, PoseLocations.GetData() + FrameB * NumTracks * 3, InterpolatedLocations.GetData(), NumTracks * 3, Alpha);
+			Locations = InterpolatedLocations.GetData();
+		}
+
+		for (const BoneTrackPair& BoneTrackPair : TranslationPairs)
+		{
+			const int32 TrackIndex = BoneTrackPair.TrackIndex;
+			OutAtoms[BoneTrackPair.AtomIndex].SetLocation(FVector(Locations[TrackIndex], Locations[NumTracks + TrackIndex], Locations[NumTracks * 2 + TrackIndex]));
+		}
+	}
+
+	if (ScalePairs.Num() > 0)
+	{
+		const float* Scales = PoseScales.GetData() + FrameA * NumTracks * 3;
+		FglTFRuntimePoseScratch InterpolatedScales;
+		if (bInterpolate)
+		{
+			InterpolatedScales.SetNumUninitialized(NumTracks * 3);
+			glTFRuntimeLerpPoseKeys(Scales, PoseScales.GetData() + FrameB * NumTracks * 3, InterpolatedScales.GetData(), NumTracks * 3, Alpha);
+			Scales = InterpolatedScales.GetData();
+		}
+
+		for (const BoneTrackPair& BoneTrackPair : ScalePairs)
+		{
+			const int32 TrackIndex = BoneTrackPair.TrackIndex;
+			OutAtoms[BoneTrackPair.AtomIndex].SetScale3D(FVector(Scales[TrackIndex], Scales[NumTracks + TrackIndex], Scales[NumTracks * 2 + TrackIndex]));
+		}
+	}
+}
+
+void UglTFAnimBoneCompressionCodec::BuildPoseTracks()
+{
+	PoseRotations.Empty();
+	PoseLocations.Empty();
+	PoseScales.Empty();
+	PoseNumTracks = 0;
+	PoseNumKeys = 0;
+
+	int32 NumKeys = 0;
+	for (const FRawAnimSequenceTrack& Track : Tracks)
+	{
+		NumKeys = FMath::Max(NumKeys, FMath::Max3(Track.PosKeys.Num(), Track.RotKeys.Num(), Track.ScaleKeys.Num()));
+	}
+
+	// constant tracks (a single key) are expanded, any other mismatch falls back to per track decompression
+	for (const FRawAnimSequenceTrack& Track : Tracks)
+	{
+		if ((Track.PosKeys.Num() != 1 && Track.PosKeys.Num() != NumKeys) ||
+			(Track.RotKeys.Num() != 1 && Track.RotKeys.Num() != NumKeys) ||
+			(Track.ScaleKeys.Num() != 1 && Track.ScaleKeys.Num() != NumKeys))
+		{
+			return;
+		}
+	}
+
+	const int32 NumTracks = Tracks.Num();
+	if (NumTracks == 0 || NumKeys == 0)
+	{
+		return;
 	}
+
+	PoseRotations.SetNumUninitialized(NumKeys * NumTracks * 4);
+	PoseLocations.SetNumUninitialized(NumKeys * NumTracks * 3);
+	PoseScales.SetNumUninitialized(NumKeys * NumTracks * 3);
+
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; TrackIndex++)
+	{
+		const FRawAnimSequenceTrack& Track = Tracks[TrackIndex];
+		for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++)
+		{
+			const auto& Rotation = Track.RotKeys[Track.RotKeys.Num() > 1 ? KeyIndex : 0];
+			float* Rotations = PoseRotations.GetData() + KeyIndex * NumTracks * 4;
+			Rotations[TrackIndex] = Rotation.X;
+			Rotations[NumTracks + TrackIndex] = Rotation.Y;
+			Rotations[NumTracks * 2 + TrackIndex] = Rotation.Z;
+			Rotations[NumTracks * 3 + TrackIndex] = Rotation.W;
+
+			const auto& Location = Track.PosKeys[Track.PosKeys.Num() > 1 ? KeyIndex : 0];
+			float* Locations = PoseLocations.GetData() + KeyIndex * NumTracks * 3;
+			Locations[TrackIndex] = Location.X;
+			Locations[NumTracks + TrackIndex] = Location.Y;
+			Locations[NumTracks * 2 + TrackIndex] = Location.Z;
+
+			const auto& Scale = Track.ScaleKeys[Track.ScaleKeys.Num() > 1 ? KeyIndex : 0];
+			float* Scales = PoseScales.GetData() + KeyIndex * NumTracks * 3;
+			Scales[TrackIndex] = Scale.X;
+			Scales[NumTracks + TrackIndex] = Scale.Y;
+			Scales[NumTracks * 2 + TrackIndex] = Scale.Z;
+		}
+	}
+
+	PoseNumTracks = NumTracks;
+	PoseNumKeys = NumKeys;
 }
 
 // Taken from official Unreal Engine code base.
@@ -1,15 +1,22 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntime.h"
+#include "glTFRuntimeGameThreadQueue.h"
+#include "glTFRuntimeTaskScheduler.h"
 
 #define LOCTEXT_NAMESPACE "FglTFRuntimeModule"
 
 void FglTFRuntimeModule::StartupModule()
 {
+	FglTFRuntimeGameThreadQueue::Get().Startup();
+	FglTFRuntimeTaskScheduler::Get().Startup();
 }
 
 void FglTFRuntimeModule::ShutdownModule()
 {
+	// releases the workers waiting for the game thread, so that the scheduler can join them
+	FglTFRuntimeGameThreadQueue::Get().Shutdown();
+	FglTFRuntimeTaskScheduler::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
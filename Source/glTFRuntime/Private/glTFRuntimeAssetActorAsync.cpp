@@ -16,6 +16,7 @@ AglTFRuntimeAssetActorAsync::AglTFRuntimeAssetActorAsync()
 	RootComponent = AssetRoot;
 
 	bShowWhileLoading = true;
+	MaxConcurrentMeshLoads = 4;
 }
 
 // Called when the game starts or when spawned
@@ -48,6 +49,24 @@ void AglTFRuntimeAssetActorAsync::BeginPlay()
 		}
 	}
 
+	// each mesh (and skin) is loaded only once and assigned to all of the related components
+	TMap<FIntPoint, UglTFRuntimeAssetActorAsyncMeshRequest*> MeshRequests;
+	for (const TPair<UPrimitiveComponent*, FglTFRuntimeNode>& Pair : MeshesToLoad)
+	{
+		const FIntPoint MeshKey(Pair.Value.MeshIndex, Cast<USkeletalMeshComponent>(Pair.Key) ? Pair.Value.SkinIndex : INDEX_NONE);
+		UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest = MeshRequests.FindRef(MeshKey);
+		if (!MeshRequest)
+		{
+			MeshRequest = NewObject<UglTFRuntimeAssetActorAsyncMeshRequest>(this);
+			MeshRequest->MeshIndex = MeshKey.X;
+			MeshRequest->SkinIndex = MeshKey.Y;
+			MeshRequests.Add(MeshKey, MeshRequest);
+			PendingMeshRequests.Add(MeshRequest);
+		}
+		MeshRequest->Components.Add(Pair.Key);
+	}
+	MeshesToLoad.Empty();
+
 	LoadNextMeshAsync();
 }
 
@@ -129,36 +148,43 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 
 void AglTFRuntimeAssetActorAsync::LoadNextMeshAsync()
 {
-	if (MeshesToLoad.Num() == 0)
+	while (PendingMeshRequests.Num() > 0 && RunningMeshRequests.Num() < FMath::Max(1, MaxConcurrentMeshLoads))
 	{
-		return;
-	}
+		UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest = PendingMeshRequests[0];
+		PendingMeshRequests.RemoveAt(0);
+		RunningMeshRequests.Add(MeshRequest);
 
-	auto It = MeshesToLoad.CreateIterator();
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(It->Key))
-	{
-		CurrentPrimitiveComponent = StaticMeshComponent;
-		if (StaticMeshConfig.Outer == nullptr)
+		// note: cached meshes are returned immediately (re-entering LoadNextMeshAsync)
+		if (MeshRequest->SkinIndex == INDEX_NONE)
 		{
-			StaticMeshConfig.Outer = StaticMeshComponent;
+			FglTFRuntimeStaticMeshConfig MeshRequestStaticMeshConfig = StaticMeshConfig;
+			if (MeshRequestStaticMeshConfig.Outer == nullptr)
+			{
+				MeshRequestStaticMeshConfig.Outer = MeshRequest->Components[0];
+			}
+			FglTFRuntimeStaticMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::OnStaticMeshLoaded);
+			Asset->LoadStaticMeshAsync(MeshRequest->MeshIndex, Delegate, MeshRequestStaticMeshConfig);
+		}
+		else
+		{
+			FglTFRuntimeSkeletalMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::OnSkeletalMeshLoaded);
+			Asset->LoadSkeletalMeshAsync(MeshRequest->MeshIndex, MeshRequest->SkinIndex, Delegate, SkeletalMeshConfig);
 		}
-		FglTFRuntimeStaticMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync);
-		Asset->LoadStaticMeshAsync(It->Value.MeshIndex, Delegate, StaticMeshConfig);
-	}
-	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(It->Key))
-	{
-		CurrentPrimitiveComponent = SkeletalMeshComponent;
-		FglTFRuntimeSkeletalMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync);
-		Asset->LoadSkeletalMeshAsync(It->Value.MeshIndex, It->Value.SkinIndex, Delegate, SkeletalMeshConfig);
 	}
 }
 
-void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
+void AglTFRuntimeAssetActorAsync::OnStaticMeshRequestLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, UStaticMesh* StaticMesh)
 {
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(CurrentPrimitiveComponent))
+	for (UPrimitiveComponent* PrimitiveComponent : MeshRequest->Components)
 	{
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(PrimitiveComponent);
+		if (!StaticMeshComponent)
+		{
+			continue;
+		}
+
 		DiscoveredStaticMeshComponents.Add(StaticMeshComponent, StaticMesh);
 		if (bShowWhileLoading)
 		{
@@ -177,25 +203,21 @@ void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
 				StaticMeshComponent->SetRelativeTransform(NewTransform);
 			}
 		}
-
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
-	{
-		LoadNextMeshAsync();
-	}
-	// trigger event
-	else
-	{
-		ScenesLoaded();
-	}
+	MeshRequestCompleted(MeshRequest);
 }
 
-void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh)
+void AglTFRuntimeAssetActorAsync::OnSkeletalMeshRequestLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, USkeletalMesh* SkeletalMesh)
 {
-	if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(CurrentPrimitiveComponent))
+	for (UPrimitiveComponent* PrimitiveComponent : MeshRequest->Components)
 	{
+		USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(PrimitiveComponent);
+		if (!SkeletalMeshComponent)
+		{
+			continue;
+		}
+
 		DiscoveredSkeletalMeshComponents.Add(SkeletalMeshComponent, SkeletalMesh);
 		if (bShowWhileLoading)
 		{
@@ -203,13 +225,19 @@ void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalM
 		}
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
+	MeshRequestCompleted(MeshRequest);
+}
+
+void AglTFRuntimeAssetActorAsync::MeshRequestCompleted(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest)
+{
+	RunningMeshRequests.Remove(MeshRequest);
+
+	if (PendingMeshRequests.Num() > 0)
 	{
 		LoadNextMeshAsync();
 	}
 	// trigger event
-	else
+	else if (RunningMeshRequests.Num() == 0)
 	{
 		ScenesLoaded();
 	}
@@ -251,3 +279,19 @@ void AglTFRuntimeAssetActorAsync::ReceiveOnScenesLoaded_Implementation()
 {
 
 }
+
+void UglTFRuntimeAssetActorAsyncMeshRequest::OnStaticMeshLoaded(UStaticMesh* StaticMesh)
+{
+	if (AglTFRuntimeAssetActorAsync* AssetActor = Cast<AglTFRuntimeAssetActorAsync>(GetOuter()))
+	{
+		AssetActor->OnStaticMeshRequestLoaded(this, StaticMesh);
+	}
+}
+
+void UglTFRuntimeAssetActorAsyncMeshRequest::OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh)
+{
+	if (AglTFRuntimeAssetActorAsync* AssetActor = Cast<AglTFRuntimeAssetActorAsync>(GetOuter()))
+	{
+		AssetActor->OnSkeletalMeshRequestLoaded(this, SkeletalMesh);
+	}
+}
@@ -3,6 +3,9 @@
 
 #include "glTFRuntimeFunctionLibrary.h"
 #include "Async/Async.h"
+#include "glTFRuntimeTaskScheduler.h"
+#include "glTFRuntimeGameThreadQueue.h"
+#include "glTFRuntimeGLBStreamReader.h"
 #include "HttpModule.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "Interfaces/IHttpRequest.h"
@@ -56,12 +59,13 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 		OverrideConfig.bSearchContentDir = true;
 	}
 
-	Async(EAsyncExecution::Thread, [Filename, Asset, Completed, OverrideConfig]()
+	// not bound to a parser yet, the load cannot be cancelled
+	FglTFRuntimeTaskScheduler::Get().Enqueue(0, [Filename, Asset, Completed, OverrideConfig]()
 		{
 			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, OverrideConfig);
 
 
-	FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([Parser, Asset, Completed]()
+	FglTFRuntimeGameThreadQueue::Get().Enqueue([Parser, Asset, Completed]()
 		{
 			if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
 			{
@@ -71,9 +75,11 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFilenameAsync(const FString&
 			{
 				Completed.ExecuteIfBound(nullptr);
 			}
-		}, TStatId(), nullptr, ENamedThreads::GameThread);
-	FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 		});
+		}, [Completed]()
+		{
+			FglTFRuntimeGameThreadQueue::Get().Enqueue([Completed]() { Completed.ExecuteIfBound(nullptr); });
+		}, EglTFRuntimeTaskPriority::High);
 }
 
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig)
@@ -157,6 +163,82 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString
 	HttpRequest->ProcessRequest();
 }
 
+void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlStreaming(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse SceneReady, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+{
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+#else
+	TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
+#endif
+	HttpRequest->SetURL(Url);
+	for (TPair<FString, FString> Header : Headers)
+	{
+		HttpRequest->AppendToHeader(Header.Key, Header.Value);
+	}
+
+	// the reader and the asset are only accessed from the game thread
+	TSharedRef<FglTFRuntimeGLBStreamReader> StreamReader = MakeShared<FglTFRuntimeGLBStreamReader>(LoaderConfig);
+	TSharedRef<TWeakObjectPtr<UglTFRuntimeAsset>> AssetPtr = MakeShared<TWeakObjectPtr<UglTFRuntimeAsset>>();
+
+	StreamReader->OnParserReady.BindLambda([AssetPtr, SceneReady, LoaderConfig](TSharedRef<FglTFRuntimeParser> Parser)
+		{
+			UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+			Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+			Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+			if (Asset->SetParser(Parser))
+			{
+				*AssetPtr = Asset;
+				SceneReady.ExecuteIfBound(Asset);
+			}
+		});
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1
+	const bool bStreaming = HttpRequest->SetResponseBodyReceiveStreamDelegate(FHttpRequestStreamDelegate::CreateLambda([StreamReader](void* Ptr, int64 Length)
+		{
+			// called from the http thread, move the chunk to the game thread
+			TArray64<uint8> Chunk;
+			Chunk.Append(reinterpret_cast<const uint8*>(Ptr), Length);
+			AsyncTask(ENamedThreads::GameThread, [StreamReader, Chunk = MoveTemp(Chunk)]()
+				{
+					StreamReader->Feed(Chunk.GetData(), Chunk.Num());
+				});
+			return true;
+		}));
+#else
+	const bool bStreaming = false;
+#endif
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([StreamReader, AssetPtr, Completed, bStreaming](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess)
+		{
+			if (!bSuccess || !ResponsePtr.IsValid())
+			{
+				StreamReader->Abort();
+				Completed.ExecuteIfBound(nullptr);
+				return;
+			}
+
+			if (!bStreaming)
+			{
+				StreamReader->Feed(ResponsePtr->GetContent().GetData(), ResponsePtr->GetContent().Num());
+			}
+
+			// enqueued after the pending chunks
+			AsyncTask(ENamedThreads::GameThread, [StreamReader, AssetPtr, Completed]()
+				{
+					if (StreamReader->Finish() && AssetPtr->IsValid())
+					{
+						Completed.ExecuteIfBound(AssetPtr->Get());
+					}
+					else
+					{
+						Completed.ExecuteIfBound(nullptr);
+					}
+				});
+		});
+
+	HttpRequest->ProcessRequest();
+}
+
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig)
 {
 	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
@@ -0,0 +1,231 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeGLBStreamReader.h"
+#include "HAL/PlatformFileManager.h"
+
+FglTFRuntimeGLBStreamReader::FglTFRuntimeGLBStreamReader(const FglTFRuntimeConfig& InLoaderConfig) : LoaderConfig(InLoaderConfig)
+{
+	State = EState::Header;
+	ChunkRemaining = 0;
+	bCollectingJson = false;
+	bStreamingBinary = false;
+	bBinaryFound = false;
+	bFallback = false;
+	bError = false;
+	bParserPending = false;
+}
+
+bool FglTFRuntimeGLBStreamReader::SetError(const FString& Message)
+{
+	UE_LOG(LogGLTFRuntime, Error, TEXT("GLB Stream: %s"), *Message);
+	bError = true;
+	Abort();
+	return false;
+}
+
+void FglTFRuntimeGLBStreamReader::Abort()
+{
+	if (Parser)
+	{
+		Parser->AbortBinaryBufferStream();
+	}
+}
+
+void FglTFRuntimeGLBStreamReader::PublishParser()
+{
+	if (bParserPending)
+	{
+		bParserPending = false;
+		OnParserReady.ExecuteIfBound(Parser.ToSharedRef());
+	}
+}
+
+bool FglTFRuntimeGLBStreamReader::Feed(const uint8* Data, const int64 Num)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeGLBStreamReader_Feed, FColor::Magenta);
+
+	if (bError)
+	{
+		return false;
+	}
+
+	if (bFallback)
+	{
+		FallbackData.Append(Data, Num);
+		return true;
+	}
+
+	int64 Offset = 0;
+	while (Offset < Num)
+	{
+		if (State == EState::Header || State == EState::ChunkHeader)
+		{
+			const int32 HeaderSize = State == EState::Header ? 12 : 8;
+			const int64 ToCopy = FMath::Min<int64>(HeaderSize - HeaderData.Num(), Num - Offset);
+			HeaderData.Append(Data + Offset, ToCopy);
+			Offset += ToCopy;
+
+			if (HeaderData.Num() < HeaderSize)
+			{
+				break;
+			}
+
+			if (State == EState::Header)
+			{
+				if (HeaderData[0] != 0x67 || HeaderData[1] != 0x6C || HeaderData[2] != 0x54 || HeaderData[3] != 0x46)
+				{
+					// not a GLB, collect everything and parse it at the end
+					bFallback = true;
+					FallbackData.Append(HeaderData.GetData(), HeaderData.Num());
+					FallbackData.Append(Data + Offset, Num - Offset);
+					HeaderData.Reset();
+					return true;
+				}
+				State = EState::ChunkHeader;
+				HeaderData.Reset();
+				continue;
+			}
+
+			const uint32 ChunkLength = *reinterpret_cast<const uint32*>(HeaderData.GetData());
+			const uint32 ChunkType = *reinterpret_cast<const uint32*>(HeaderData.GetData() + 4);
+			HeaderData.Reset();
+
+			ChunkRemaining = ChunkLength;
+			State = EState::ChunkBody;
+
+			if (ChunkType == 0x4E4F534A && !Parser && !bCollectingJson)
+			{
+				bCollectingJson = true;
+				JsonData.Empty(ChunkLength);
+			}
+			else if (ChunkType == 0x004E4942 && !bBinaryFound)
+			{
+				if (!Parser)
+				{
+					return SetError("BIN chunk found before JSON chunk.");
+				}
+				bBinaryFound = true;
+				bStreamingBinary = true;
+				Parser->StartBinaryBufferStream(ChunkLength);
+			}
+
+			// the parser is shared only when the binary buffer cannot be reallocated anymore
+			PublishParser();
+
+			if (ChunkRemaining == 0 && !EndChunk())
+			{
+				return false;
+			}
+			continue;
+		}
+
+		const int64 ToCopy = FMath::Min(ChunkRemaining, Num - Offset);
+		if (bCollectingJson)
+		{
+			JsonData.Append(Data + Offset, ToCopy);
+		}
+		else if (bStreamingBinary && !Parser->AppendBinaryBufferStream(Data + Offset, ToCopy))
+		{
+			return SetError("Unable to append data to the BIN chunk.");
+		}
+		Offset += ToCopy;
+		ChunkRemaining -= ToCopy;
+
+		if (ChunkRemaining == 0 && !EndChunk())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeGLBStreamReader::EndChunk()
+{
+	State = EState::ChunkHeader;
+
+	if (bCollectingJson)
+	{
+		bCollectingJson = false;
+
+		Parser = FglTFRuntimeParser::FromJsonBytes(JsonData.GetData(), JsonData.Num(), LoaderConfig);
+		JsonData.Empty();
+		if (!Parser)
+		{
+			return SetError("Unable to parse JSON chunk.");
+		}
+
+		// published with the next chunk header (or at the end of the stream)
+		bParserPending = true;
+	}
+	else if (bStreamingBinary)
+	{
+		bStreamingBinary = false;
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeGLBStreamReader::FeedFromFile(const FString& Filename, const int64 ReadChunkSize)
+{
+	TUniquePtr<IFileHandle> FileHandle = TUniquePtr<IFileHandle>(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Filename));
+	if (!FileHandle)
+	{
+		return SetError(FString::Printf(TEXT("Unable to open file %s"), *Filename));
+	}
+
+	TArray64<uint8> ReadBuffer;
+	ReadBuffer.AddUninitialized(FMath::Max<int64>(ReadChunkSize, 12));
+
+	int64 Remaining = FileHandle->Size();
+	while (Remaining > 0)
+	{
+		const int64 ToRead = FMath::Min(Remaining, ReadBuffer.Num());
+		if (!FileHandle->Read(ReadBuffer.GetData(), ToRead))
+		{
+			return SetError(FString::Printf(TEXT("Unable to read file %s"), *Filename));
+		}
+
+		if (!Feed(ReadBuffer.GetData(), ToRead))
+		{
+			return false;
+		}
+		Remaining -= ToRead;
+	}
+
+	return Finish();
+}
+
+bool FglTFRuntimeGLBStreamReader::Finish()
+{
+	if (bError)
+	{
+		return false;
+	}
+
+	if (bFallback)
+	{
+		Parser = FglTFRuntimeParser::FromData(FallbackData.GetData(), FallbackData.Num(), LoaderConfig);
+		FallbackData.Empty();
+		if (!Parser)
+		{
+			return SetError("Unable to parse data.");
+		}
+		OnParserReady.ExecuteIfBound(Parser.ToSharedRef());
+		return true;
+	}
+
+	if (!Parser)
+	{
+		return SetError("JSON chunk not found.");
+	}
+
+	if (State != EState::ChunkHeader || HeaderData.Num() > 0)
+	{
+		return SetError("Truncated GLB stream.");
+	}
+
+	PublishParser();
+
+	return true;
+}
@@ -0,0 +1,241 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeGameThreadQueue.h"
+#include "glTFRuntimeParser.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+
+FglTFRuntimeGameThreadQueue& FglTFRuntimeGameThreadQueue::Get()
+{
+	static FglTFRuntimeGameThreadQueue Queue;
+	return Queue;
+}
+
+static TAutoConsoleVariable<float> CVarglTFRuntimeGameThreadFrameBudgetMs(
+	TEXT("glTFRuntime.GameThreadFrameBudgetMs"),
+	5.0f,
+	TEXT("Game thread time (per frame, in milliseconds) for completing glTFRuntime async loads, 0 means no budget."),
+	ECVF_Default);
+
+static FAutoConsoleCommand CCmdglTFRuntimeDumpStageStats(
+	TEXT("glTFRuntime.DumpStageStats"),
+	TEXT("Log the game thread time spent in each glTFRuntime finalization stage (since the start or the last reset)."),
+	FConsoleCommandDelegate::CreateLambda([]()
+		{
+			TMap<FName, FglTFRuntimeStageStats> StageStats = FglTFRuntimeGameThreadQueue::Get().GetStageStats();
+			StageStats.KeySort(FNameLexicalLess());
+			for (const TPair<FName, FglTFRuntimeStageStats>& Pair : StageStats)
+			{
+				UE_LOG(LogGLTFRuntime, Display, TEXT("%s: %d calls, total %.3f ms, avg %.3f ms, max %.3f ms"), *Pair.Key.ToString(), Pair.Value.Count,
+					Pair.Value.TotalSeconds * 1000, Pair.Value.TotalSeconds * 1000 / FMath::Max(1, Pair.Value.Count), Pair.Value.MaxSeconds * 1000);
+			}
+		}));
+
+static FAutoConsoleCommand CCmdglTFRuntimeResetStageStats(
+	TEXT("glTFRuntime.ResetStageStats"),
+	TEXT("Reset the glTFRuntime finalization stages stats."),
+	FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FglTFRuntimeGameThreadQueue::Get().ResetStageStats();
+		}));
+
+FglTFRuntimeGameThreadQueue::FglTFRuntimeGameThreadQueue()
+{
+	FrameBudgetUs.Set(5000);
+}
+
+void FglTFRuntimeGameThreadQueue::Startup()
+{
+	SetFrameBudgetMs(CVarglTFRuntimeGameThreadFrameBudgetMs.GetValueOnGameThread());
+	CVarglTFRuntimeGameThreadFrameBudgetMs->SetOnChangedCallback(FConsoleVariableDelegate::CreateLambda([this](IConsoleVariable* Variable)
+		{
+			SetFrameBudgetMs(Variable->GetFloat());
+		}));
+
+	FScopeLock Lock(&StateLock);
+#if ENGINE_MAJOR_VERSION >= 5
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FglTFRuntimeGameThreadQueue::Tick));
+#else
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FglTFRuntimeGameThreadQueue::Tick));
+#endif
+	bShutdown = false;
+	bStarted = true;
+}
+
+void FglTFRuntimeGameThreadQueue::Shutdown()
+{
+	CVarglTFRuntimeGameThreadFrameBudgetMs->SetOnChangedCallback(FConsoleVariableDelegate());
+
+	{
+		FScopeLock Lock(&StateLock);
+		bShutdown = true;
+		bStarted = false;
+	}
+
+	if (TickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION >= 5
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+		TickerHandle.Reset();
+	}
+
+	// nothing can be queued anymore: release the waiting workers and drop the continuations
+	FWaitingTask WaitingTask;
+	while (HighPriorityTasks.Dequeue(WaitingTask))
+	{
+		NumPending.Decrement();
+		*WaitingTask.bExecuted = false;
+		WaitingTask.CompletionEvent->Trigger();
+	}
+
+	TFunction<void()> Task;
+	while (Tasks.Dequeue(Task))
+	{
+		NumPending.Decrement();
+	}
+}
+
+void FglTFRuntimeGameThreadQueue::Enqueue(TFunction<void()> Task)
+{
+	FScopeLock Lock(&StateLock);
+
+	if (bShutdown)
+	{
+		return;
+	}
+
+	// no ticker (e.g. module not started), fallback to the task graph
+	if (!bStarted)
+	{
+		AsyncTask(ENamedThreads::GameThread, MoveTemp(Task));
+		return;
+	}
+
+	NumPending.Increment();
+	Tasks.Enqueue(MoveTemp(Task));
+}
+
+bool FglTFRuntimeGameThreadQueue::EnqueueAndWait(TFunction<void()> Task)
+{
+	if (IsInGameThread())
+	{
+		Task();
+		return true;
+	}
+
+	FEvent* CompletionEvent = FPlatformProcess::GetSynchEventFromPool();
+	ON_SCOPE_EXIT
+	{
+		FPlatformProcess::ReturnSynchEventToPool(CompletionEvent);
+	};
+
+	bool bExecuted = true;
+	bool bQueued = false;
+
+	{
+		FScopeLock Lock(&StateLock);
+
+		if (bShutdown)
+		{
+			return false;
+		}
+
+		if (bStarted)
+		{
+			NumPending.Increment();
+			HighPriorityTasks.Enqueue({ &Task, CompletionEvent, &bExecuted });
+			bQueued = true;
+		}
+	}
+
+	if (!bQueued)
+	{
+		// the module is not started, use the task graph
+		FGraphEventRef GraphTask = FFunctionGraphTask::CreateAndDispatchWhenReady(MoveTemp(Task), TStatId(), nullptr, ENamedThreads::GameThread);
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(GraphTask);
+		return true;
+	}
+
+	// triggered by Tick() or by Shutdown()
+	CompletionEvent->Wait();
+	return bExecuted;
+}
+
+void FglTFRuntimeGameThreadQueue::EnqueueResumable(TFunction<bool()> Task)
+{
+	Enqueue([this, Task = MoveTemp(Task)]() mutable
+		{
+			if (!Task())
+			{
+				EnqueueResumable(MoveTemp(Task));
+			}
+		});
+}
+
+void FglTFRuntimeGameThreadQueue::AddStageStats(const FName Stage, const double Seconds)
+{
+	FScopeLock Lock(&StageStatsLock);
+	FglTFRuntimeStageStats& Stats = StageStats.FindOrAdd(Stage);
+	Stats.Count++;
+	Stats.TotalSeconds += Seconds;
+	Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, Seconds);
+}
+
+TMap<FName, FglTFRuntimeStageStats> FglTFRuntimeGameThreadQueue::GetStageStats() const
+{
+	FScopeLock Lock(&StageStatsLock);
+	return StageStats;
+}
+
+void FglTFRuntimeGameThreadQueue::ResetStageStats()
+{
+	FScopeLock Lock(&StageStatsLock);
+	StageStats.Empty();
+}
+
+void FglTFRuntimeGameThreadQueue::SetFrameBudgetMs(const float InFrameBudgetMs)
+{
+	FrameBudgetUs.Set(FMath::RoundToInt(FMath::Max(0.f, InFrameBudgetMs) * 1000.0f));
+}
+
+bool FglTFRuntimeGameThreadQueue::Tick(float DeltaTime)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeGameThreadQueue_Tick, FColor::Magenta);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Budget = FrameBudgetUs.GetValue() / 1000000.0;
+
+	FWaitingTask WaitingTask;
+	TFunction<void()> Task;
+	for (;;)
+	{
+		if (HighPriorityTasks.Dequeue(WaitingTask))
+		{
+			NumPending.Decrement();
+			(*WaitingTask.Task)();
+			WaitingTask.CompletionEvent->Trigger();
+		}
+		else if (Tasks.Dequeue(Task))
+		{
+			NumPending.Decrement();
+			Task();
+		}
+		else
+		{
+			break;
+		}
+
+		if (Budget > 0 && FPlatformTime::Seconds() - StartTime >= Budget)
+		{
+			break;
+		}
+	}
+
+	return true;
+}
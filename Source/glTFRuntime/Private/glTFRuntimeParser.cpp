@@ -1,9 +1,15 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntimeGLBStreamReader.h"
+#include "glTFRuntimeTaskScheduler.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Texture2D.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
 #include "Misc/FileHelper.h"
+#include "HAL/PlatformFileManager.h"
 #include "Serialization/JsonSerializer.h"
 #include "Animation/Skeleton.h"
 #include "Materials/Material.h"
@@ -22,6 +28,10 @@
 #include "RenderUtils.h"
 #endif
 
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
 DEFINE_LOG_CATEGORY(LogGLTFRuntime);
 
 FglTFRuntimeOnPreLoadedPrimitive FglTFRuntimeParser::OnPreLoadedPrimitive;
@@ -69,14 +79,40 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 		}
 	}
 
-	TArray64<uint8> Content;
-	if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+	TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile = nullptr;
+	if (LoaderConfig.bUseMappedFile)
 	{
-		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
-		return nullptr;
+		MappedFile = MakeShared<FglTFRuntimeMappedFile>();
+		MappedFile->Handle = TUniquePtr<IMappedFileHandle>(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*TruePath));
+		if (MappedFile->Handle && MappedFile->Handle->GetFileSize() > 0)
+		{
+			MappedFile->Region = TUniquePtr<IMappedFileRegion>(MappedFile->Handle->MapRegion(0, MappedFile->Handle->GetFileSize()));
+		}
+
+		if (!MappedFile->Region)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to map file %s, falling back to standard loading"), *Filename);
+			MappedFile = nullptr;
+		}
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+	if (MappedFile)
+	{
+		Parser = FromData(MappedFile->Region->GetMappedPtr(), MappedFile->Region->GetMappedSize(), LoaderConfig, MappedFile);
+	}
+	else
+	{
+		TArray64<uint8> Content;
+		if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
+			return nullptr;
+		}
+
+		Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+	}
 
 	if (Parser && LoaderConfig.bAllowExternalFiles)
 	{
@@ -87,102 +123,67 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData, FColor::Magenta);
 
 	// required for Gzip;
-	TArray<uint8> UncompressedData;
+	TArray64<uint8> UncompressedData;
 
 	// Gzip Compressed ? 10 bytes header and 8 bytes footer
 	if (DataNum > 18 && DataPtr[0] == 0x1F && DataPtr[1] == 0x8B && DataPtr[2] == 0x08)
 	{
-		uint32* GzipOriginalSize = (uint32*)(&DataPtr[DataNum - 4]);
-		int64 StartOfBuffer = 10;
-		// FEXTRA
-		if (DataPtr[3] & 0x04)
-		{
-			uint16* FExtraXLen = (uint16*)(&DataPtr[StartOfBuffer]);
-			if (StartOfBuffer + 2 >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA header."));
-				return nullptr;
-			}
-			StartOfBuffer += 2 + *FExtraXLen;
-			if (StartOfBuffer >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA XLEN."));
-				return nullptr;
-			}
-		}
-
-		// FNAME
-		if (DataPtr[3] & 0x08)
+		if (!LoaderConfig.bAsBlob)
 		{
-			while (DataPtr[StartOfBuffer] != 0)
-			{
-				StartOfBuffer++;
-				if (StartOfBuffer >= DataNum)
-				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
-					return nullptr;
-				}
-			}
-			if (++StartOfBuffer >= DataNum)
+			// uncompressed data is directly streamed to the GLB reader (non GLB content is collected)
+			FglTFRuntimeGLBStreamReader StreamReader(LoaderConfig);
+			if (!InflateGzip(DataPtr, DataNum, [&StreamReader](const uint8* Chunk, const int64 ChunkNum) { return StreamReader.Feed(Chunk, ChunkNum); }))
 			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to uncompress Gzip data."));
 				return nullptr;
 			}
-		}
 
-		// FCOMMENT
-		if (DataPtr[3] & 0x10)
-		{
-			while (DataPtr[StartOfBuffer] != 0)
+			if (!StreamReader.Finish())
 			{
-				StartOfBuffer++;
-				if (StartOfBuffer >= DataNum)
-				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
-					return nullptr;
-				}
-			}
-			if (++StartOfBuffer >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
 				return nullptr;
 			}
-		}
 
-		// FHCRC
-		if (DataPtr[3] & 0x02)
-		{
-			if (StartOfBuffer + 2 >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FHCRC header."));
-				return nullptr;
-			}
-			StartOfBuffer += 2;
+			return StreamReader.GetParser();
 		}
 
-		UncompressedData.AddUninitialized(*GzipOriginalSize);
-		if (!FCompression::UncompressMemory(NAME_Zlib, UncompressedData.GetData(), *GzipOriginalSize, &DataPtr[StartOfBuffer], DataNum - StartOfBuffer - 8, COMPRESS_NoFlags, -15))
+		if (!InflateGzip(DataPtr, DataNum, [&UncompressedData](const uint8* Chunk, const int64 ChunkNum) { UncompressedData.Append(Chunk, ChunkNum); return true; }))
 		{
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to uncompress Gzip data."));
 			return nullptr;
 		}
 
 		DataPtr = UncompressedData.GetData();
-		DataNum = *GzipOriginalSize;
+		DataNum = UncompressedData.Num();
+		// data does not live in the mapped file anymore
+		InMappedFile = nullptr;
 	}
 
 	// Zip archive ?
 	TSharedPtr<FglTFRuntimeZipFile> ZipFile = nullptr;
-	TArray64<uint8> UnzippedData;
+	FglTFRuntimeZipEntryContent UnzippedContent;
 	if (DataNum > 4 && DataPtr[0] == 0x50 && DataPtr[1] == 0x4b && DataPtr[2] == 0x03 && DataPtr[3] == 0x04)
 	{
 		ZipFile = MakeShared<FglTFRuntimeZipFile>();
-		if (!ZipFile->FromData(DataPtr, DataNum))
+		bool bZipParsed = false;
+		if (InMappedFile)
+		{
+			bZipParsed = ZipFile->FromDataView(DataPtr, DataNum, InMappedFile);
+		}
+		// gzipped archive, no need to copy it again
+		else if (DataPtr == UncompressedData.GetData())
+		{
+			bZipParsed = ZipFile->FromData(MoveTemp(UncompressedData));
+		}
+		else
+		{
+			bZipParsed = ZipFile->FromData(DataPtr, DataNum);
+		}
+		if (!bZipParsed)
 		{
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
 			return nullptr;
@@ -210,17 +211,15 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 			return nullptr;
 		}
 
-		if (!ZipFile->GetFileContent(Filename, UnzippedData))
+		if (!ZipFile->GetFileContent(Filename, UnzippedContent))
 		{
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to get %s from Zip archive."), *Filename);
 			return nullptr;
 		}
 
-		if (UnzippedData.Num() > 0)
-		{
-			DataPtr = UnzippedData.GetData();
-			DataNum = UnzippedData.Num();
-		}
+		DataPtr = UnzippedContent.Data;
+		DataNum = UnzippedContent.Num;
+		InMappedFile = nullptr;
 	}
 
 	if (LoaderConfig.bAsBlob)
@@ -241,20 +240,85 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 			DataPtr[2] == 0x54 &&
 			DataPtr[3] == 0x46)
 		{
-			return FromBinary(DataPtr, DataNum, LoaderConfig, ZipFile);
+			return FromBinary(DataPtr, DataNum, LoaderConfig, ZipFile, InMappedFile);
 		}
 	}
 
-	if (DataNum > 0 && DataNum <= INT32_MAX)
+	if (DataNum > 0)
 	{
-		FString JsonData;
-		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
-		return FromString(JsonData, LoaderConfig, ZipFile);
+		return FromJsonBytes(DataPtr, DataNum, LoaderConfig, ZipFile);
 	}
 
 	return nullptr;
 }
 
+bool FglTFRuntimeParser::InflateGzip(const uint8* Source, const int64 SourceNum, TFunctionRef<bool(const uint8*, const int64)> Consumer)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_InflateGzip, FColor::Magenta);
+
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	// zlib manages the gzip header and trailer
+	if (inflateInit2(&Stream, 16 + MAX_WBITS) != Z_OK)
+	{
+		return false;
+	}
+
+	// zlib counters are 32 bit, feed the stream in slices
+	constexpr int64 SliceSize = 1024 * 1024 * 1024;
+	constexpr int64 WindowSize = 1024 * 1024;
+
+	TArray64<uint8> Window;
+	Window.AddUninitialized(WindowSize);
+
+	int64 SourceOffset = 0;
+	bool bSuccess = false;
+
+	for (;;)
+	{
+		if (Stream.avail_in == 0 && SourceOffset < SourceNum)
+		{
+			const int64 Slice = FMath::Min(SourceNum - SourceOffset, SliceSize);
+			Stream.next_in = const_cast<Bytef*>(Source + SourceOffset);
+			Stream.avail_in = (uInt)Slice;
+			SourceOffset += Slice;
+		}
+
+		Stream.next_out = Window.GetData();
+		Stream.avail_out = (uInt)WindowSize;
+
+		const int32 Result = inflate(&Stream, Z_NO_FLUSH);
+		if (Result != Z_OK && Result != Z_STREAM_END)
+		{
+			break;
+		}
+
+		const int64 Produced = WindowSize - Stream.avail_out;
+		if (Produced > 0 && !Consumer(Window.GetData(), Produced))
+		{
+			break;
+		}
+
+		if (Result == Z_STREAM_END)
+		{
+			// multiple members ?
+			const int64 Remaining = Stream.avail_in + (SourceNum - SourceOffset);
+			const uint8* Next = Stream.avail_in > 0 ? Stream.next_in : Source + SourceOffset;
+			if (Remaining > 18 && Next[0] == 0x1F && Next[1] == 0x8B)
+			{
+				inflateReset(&Stream);
+				continue;
+			}
+			bSuccess = true;
+			break;
+		}
+	}
+
+	inflateEnd(&Stream);
+
+	return bSuccess;
+}
+
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromString, FColor::Magenta);
@@ -271,7 +335,12 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 	if (!JsonObject)
 		return nullptr;
 
-	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject.ToSharedRef(), LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
+	return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InZipFile);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+{
+	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject, LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
 
 	if (Parser)
 	{
@@ -288,17 +357,24 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 		}
 		Parser->DefaultPrefixForUnnamedNodes = LoaderConfig.PrefixForUnnamedNodes;
 		Parser->ZipFile = InZipFile;
+
+		if (InZipFile && LoaderConfig.bPrefetchArchiveEntries)
+		{
+			Parser->PrefetchArchiveEntries();
+		}
 	}
 
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
 
-	FString JsonData;
-	TArray64<uint8> BinaryBuffer;
+	const uint8* JsonPtr = nullptr;
+	int64 JsonNum = 0;
+	const uint8* BinaryPtr = nullptr;
+	int64 BinaryNum = 0;
 
 	bool bJsonFound = false;
 	bool bBinaryFound = false;
@@ -324,13 +400,15 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 		if (*ChunkType == 0x4E4F534A && !bJsonFound)
 		{
 			bJsonFound = true;
-			FFileHelper::BufferToString(JsonData, &DataPtr[BlobIndex], *ChunkLength);
+			JsonPtr = &DataPtr[BlobIndex];
+			JsonNum = *ChunkLength;
 		}
 
 		else if (*ChunkType == 0x004E4942 && !bBinaryFound)
 		{
 			bBinaryFound = true;
-			BinaryBuffer.Append(&DataPtr[BlobIndex], *ChunkLength);
+			BinaryPtr = &DataPtr[BlobIndex];
+			BinaryNum = *ChunkLength;
 		}
 
 		BlobIndex += *ChunkLength;
@@ -341,13 +419,22 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 		return nullptr;
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromString(JsonData, LoaderConfig, InZipFile);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromJsonBytes(JsonPtr, JsonNum, LoaderConfig, InZipFile);
 
 	if (Parser)
 	{
 		if (bBinaryFound)
 		{
-			Parser->SetBinaryBuffer(BinaryBuffer);
+			if (InMappedFile)
+			{
+				// zero copy, the BIN chunk is directly accessed from the mapped region
+				Parser->MappedFile = InMappedFile;
+				Parser->SetBinaryBufferView(BinaryPtr, BinaryNum);
+			}
+			else
+			{
+				Parser->BinaryBuffer.Append(BinaryPtr, BinaryNum);
+			}
 		}
 	}
 
@@ -491,22 +578,17 @@ void FglTFRuntimeParser::LoadAndFillBaseMaterials()
 }
 
 
-FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale) : Root(JsonObject), SceneBasis(InSceneBasis), SceneScale(InSceneScale)
+FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale) : Root(JsonObject), SceneBasis(InSceneBasis), SceneScale(InSceneScale), AsyncTasksOwnerId(FglTFRuntimeTaskScheduler::NewOwnerId())
 {
 	bAllNodesCached = false;
 
-	if (IsInGameThread())
-	{
-		LoadAndFillBaseMaterials();
-	}
-	else
-	{
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
-			{
-				LoadAndFillBaseMaterials();
-			}, TStatId(), nullptr, ENamedThreads::GameThread);
-		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-	}
+	BuildDocument();
+	BuildSceneBasisPermutation();
+
+	FglTFRuntimeGameThreadQueue::Get().EnqueueAndWait([this]()
+		{
+			LoadAndFillBaseMaterials();
+		});
 
 	JsonObject->TryGetStringArrayField("extensionsUsed", ExtensionsUsed);
 	JsonObject->TryGetStringArrayField("extensionsRequired", ExtensionsRequired);
@@ -537,6 +619,235 @@ FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const
 	}
 }
 
+int32 FglTFRuntimeParser::CancelAsyncLoads()
+{
+	return FglTFRuntimeTaskScheduler::Get().Cancel(AsyncTasksOwnerId);
+}
+
+void FglTFRuntimeParser::BuildSceneBasisPermutation()
+{
+	bSceneBasisIsPermutation = false;
+
+	// translation and projection are not supported by the swizzle
+	if (SceneBasis.M[3][0] != 0 || SceneBasis.M[3][1] != 0 || SceneBasis.M[3][2] != 0 ||
+		SceneBasis.M[0][3] != 0 || SceneBasis.M[1][3] != 0 || SceneBasis.M[2][3] != 0 || SceneBasis.M[3][3] != 1)
+	{
+		return;
+	}
+
+	for (int32 Column = 0; Column < 3; Column++)
+	{
+		int32 Axis = INDEX_NONE;
+		for (int32 Row = 0; Row < 3; Row++)
+		{
+			const auto Value = SceneBasis.M[Row][Column];
+			if (Value == 0)
+			{
+				continue;
+			}
+
+			if ((Value != 1 && Value != -1) || Axis != INDEX_NONE)
+			{
+				return;
+			}
+
+			Axis = Row;
+			SceneBasisSign[Column] = Value;
+		}
+
+		if (Axis == INDEX_NONE)
+		{
+			return;
+		}
+
+		SceneBasisAxis[Column] = Axis;
+	}
+
+	bSceneBasisIsPermutation = true;
+}
+
+void FglTFRuntimeParser::TransformPositions(TArray<FVector>& Positions) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_TransformPositions, FColor::Magenta);
+
+	if (bSceneBasisIsPermutation)
+	{
+		const int32 AxisX = SceneBasisAxis[0];
+		const int32 AxisY = SceneBasisAxis[1];
+		const int32 AxisZ = SceneBasisAxis[2];
+		const FVector Scale = SceneBasisSign * SceneScale;
+
+		FVector* Data = Positions.GetData();
+		const int32 Num = Positions.Num();
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			const FVector Value = Data[Index];
+			Data[Index] = FVector(Value[AxisX] * Scale.X, Value[AxisY] * Scale.Y, Value[AxisZ] * Scale.Z);
+		}
+		return;
+	}
+
+	for (FVector& Position : Positions)
+	{
+		Position = SceneBasis.TransformPosition(Position) * SceneScale;
+	}
+}
+
+void FglTFRuntimeParser::TransformNormals(TArray<FVector>& Normals) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_TransformNormals, FColor::Magenta);
+
+	if (bSceneBasisIsPermutation)
+	{
+		const int32 AxisX = SceneBasisAxis[0];
+		const int32 AxisY = SceneBasisAxis[1];
+		const int32 AxisZ = SceneBasisAxis[2];
+
+		FVector* Data = Normals.GetData();
+		const int32 Num = Normals.Num();
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			const FVector Value = Data[Index];
+			Data[Index] = FVector(Value[AxisX] * SceneBasisSign.X, Value[AxisY] * SceneBasisSign.Y, Value[AxisZ] * SceneBasisSign.Z);
+		}
+		return;
+	}
+
+	for (FVector& Normal : Normals)
+	{
+		Normal = SceneBasis.TransformVector(Normal);
+	}
+}
+
+void FglTFRuntimeParser::TransformTangents(TArray<FVector4>& Tangents) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_TransformTangents, FColor::Magenta);
+
+	if (bSceneBasisIsPermutation)
+	{
+		const int32 AxisX = SceneBasisAxis[0];
+		const int32 AxisY = SceneBasisAxis[1];
+		const int32 AxisZ = SceneBasisAxis[2];
+
+		FVector4* Data = Tangents.GetData();
+		const int32 Num = Tangents.Num();
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			const FVector4 Value = Data[Index];
+			// W (handedness) is not affected
+			Data[Index] = FVector4(Value[AxisX] * SceneBasisSign.X, Value[AxisY] * SceneBasisSign.Y, Value[AxisZ] * SceneBasisSign.Z, Value.W);
+		}
+		return;
+	}
+
+	for (FVector4& Tangent : Tangents)
+	{
+		Tangent = SceneBasis.TransformFVector4(Tangent);
+	}
+}
+
+// must match EglTFRuntimeRootArray
+static const TCHAR* glTFRuntimeRootArrayNames[] = { TEXT("nodes"), TEXT("meshes"), TEXT("materials"), TEXT("textures"), TEXT("samplers"), TEXT("accessors"), TEXT("bufferViews"), TEXT("images"), TEXT("skins"), TEXT("animations"), TEXT("scenes"), TEXT("cameras") };
+static_assert(UE_ARRAY_COUNT(glTFRuntimeRootArrayNames) == static_cast<int32>(EglTFRuntimeRootArray::Num), "glTFRuntimeRootArrayNames must match EglTFRuntimeRootArray");
+
+void FglTFRuntimeParser::BuildDocument()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_BuildDocument, FColor::Magenta);
+
+	Document.Reset();
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+
+	if (Root->TryGetArrayField("buffers", JsonArray))
+	{
+		Document.BuffersByteLength.AddUninitialized(JsonArray->Num());
+		for (int32 Index = 0; Index < JsonArray->Num(); Index++)
+		{
+			Document.BuffersByteLength[Index] = -1;
+			const TSharedPtr<FJsonObject>* JsonBufferObject = nullptr;
+			if ((*JsonArray)[Index]->TryGetObject(JsonBufferObject))
+			{
+				(*JsonBufferObject)->TryGetNumberField("byteLength", Document.BuffersByteLength[Index]);
+			}
+		}
+	}
+
+	if (Root->TryGetArrayField("bufferViews", JsonArray))
+	{
+		Document.BufferViewsBuffer.AddUninitialized(JsonArray->Num());
+		Document.BufferViewsByteOffset.AddZeroed(JsonArray->Num());
+		Document.BufferViewsByteLength.AddUninitialized(JsonArray->Num());
+		Document.BufferViewsByteStride.AddZeroed(JsonArray->Num());
+		Document.BufferViewsCompressed.AddZeroed(JsonArray->Num());
+		for (int32 Index = 0; Index < JsonArray->Num(); Index++)
+		{
+			Document.BufferViewsBuffer[Index] = INDEX_NONE;
+			Document.BufferViewsByteLength[Index] = -1;
+			const TSharedPtr<FJsonObject>* JsonBufferViewObject = nullptr;
+			if ((*JsonArray)[Index]->TryGetObject(JsonBufferViewObject))
+			{
+				// compressed views are still managed by the json path
+				if (GetJsonObjectExtension(JsonBufferViewObject->ToSharedRef(), "EXT_meshopt_compression"))
+				{
+					Document.BufferViewsCompressed[Index] = true;
+					continue;
+				}
+				(*JsonBufferViewObject)->TryGetNumberField("buffer", Document.BufferViewsBuffer[Index]);
+				(*JsonBufferViewObject)->TryGetNumberField("byteOffset", Document.BufferViewsByteOffset[Index]);
+				(*JsonBufferViewObject)->TryGetNumberField("byteLength", Document.BufferViewsByteLength[Index]);
+				(*JsonBufferViewObject)->TryGetNumberField("byteStride", Document.BufferViewsByteStride[Index]);
+			}
+		}
+	}
+
+	if (Root->TryGetArrayField("accessors", JsonArray))
+	{
+		Document.AccessorsBufferView.AddUninitialized(JsonArray->Num());
+		Document.AccessorsByteOffset.AddZeroed(JsonArray->Num());
+		Document.AccessorsComponentType.AddZeroed(JsonArray->Num());
+		Document.AccessorsCount.AddUninitialized(JsonArray->Num());
+		Document.AccessorsElements.AddZeroed(JsonArray->Num());
+		Document.AccessorsNormalized.AddZeroed(JsonArray->Num());
+		Document.AccessorsSparse.AddZeroed(JsonArray->Num());
+		for (int32 Index = 0; Index < JsonArray->Num(); Index++)
+		{
+			Document.AccessorsBufferView[Index] = INDEX_NONE;
+			Document.AccessorsCount[Index] = -1;
+			const TSharedPtr<FJsonObject>* JsonAccessorObject = nullptr;
+			if ((*JsonArray)[Index]->TryGetObject(JsonAccessorObject))
+			{
+				(*JsonAccessorObject)->TryGetNumberField("bufferView", Document.AccessorsBufferView[Index]);
+				(*JsonAccessorObject)->TryGetNumberField("byteOffset", Document.AccessorsByteOffset[Index]);
+				(*JsonAccessorObject)->TryGetNumberField("componentType", Document.AccessorsComponentType[Index]);
+				(*JsonAccessorObject)->TryGetNumberField("count", Document.AccessorsCount[Index]);
+				(*JsonAccessorObject)->TryGetBoolField("normalized", Document.AccessorsNormalized[Index]);
+				Document.AccessorsSparse[Index] = (*JsonAccessorObject)->HasTypedField<EJson::Object>("sparse");
+				FString Type;
+				if ((*JsonAccessorObject)->TryGetStringField("type", Type))
+				{
+					Document.AccessorsElements[Index] = GetTypeSize(Type);
+				}
+			}
+		}
+	}
+
+	for (int32 RootArrayIndex = 0; RootArrayIndex < static_cast<int32>(EglTFRuntimeRootArray::Num); RootArrayIndex++)
+	{
+		TArray<TSharedPtr<FJsonObject>>& Objects = Document.RootObjects[RootArrayIndex];
+		if (Root->TryGetArrayField(glTFRuntimeRootArrayNames[RootArrayIndex], JsonArray))
+		{
+			Objects.Reserve(JsonArray->Num());
+			for (const TSharedPtr<FJsonValue>& JsonValue : *JsonArray)
+			{
+				const TSharedPtr<FJsonObject>* JsonObject = nullptr;
+				Objects.Add(JsonValue->TryGetObject(JsonObject) ? *JsonObject : nullptr);
+			}
+		}
+	}
+
+	Document.bHasRootObjects = true;
+}
+
 bool FglTFRuntimeParser::LoadNodes()
 {
 	if (bAllNodesCached)
@@ -544,6 +855,16 @@ bool FglTFRuntimeParser::LoadNodes()
 		return true;
 	}
 
+	FScopeLock Lock(&AllNodesCacheLock);
+
+	// another thread may have completed the loading
+	if (bAllNodesCached)
+	{
+		return true;
+	}
+
+	AllNodesCache.Empty();
+
 	const TArray<TSharedPtr<FJsonValue>>* JsonNodes;
 
 	// no nodes ?
@@ -681,13 +1002,48 @@ bool FglTFRuntimeParser::CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, cons
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index)
 {
-	TArray<TSharedRef<FJsonValue>> JsonArray;
-	if (!CheckJsonIndex(JsonObject, FieldName, Index, JsonArray))
+	if (Index < 0)
+	{
+		return nullptr;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+	if (!JsonObject->TryGetArrayField(FieldName, JsonArray))
+	{
+		return nullptr;
+	}
+
+	if (Index >= JsonArray->Num())
 	{
 		return nullptr;
 	}
 
-	return JsonArray[Index]->AsObject();
+	return (*JsonArray)[Index]->AsObject();
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index)
+{
+	for (int32 RootArrayIndex = 0; RootArrayIndex < static_cast<int32>(EglTFRuntimeRootArray::Num); RootArrayIndex++)
+	{
+		if (FieldName == glTFRuntimeRootArrayNames[RootArrayIndex])
+		{
+			return GetJsonObjectFromRootIndex(static_cast<EglTFRuntimeRootArray>(RootArrayIndex), Index);
+		}
+	}
+
+	return GetJsonObjectFromIndex(Root, FieldName, Index);
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromRootIndex(const EglTFRuntimeRootArray RootArray, const int32 Index)
+{
+	const int32 RootArrayIndex = static_cast<int32>(RootArray);
+	if (!Document.bHasRootObjects)
+	{
+		return GetJsonObjectFromIndex(Root, glTFRuntimeRootArrayNames[RootArrayIndex], Index);
+	}
+
+	const TArray<TSharedPtr<FJsonObject>>& Objects = Document.RootObjects[RootArrayIndex];
+	return Objects.IsValidIndex(Index) ? Objects[Index] : nullptr;
 }
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index)
@@ -938,7 +1294,7 @@ TArray<double> FglTFRuntimeParser::GetJsonExtensionObjectNumbers(TSharedRef<FJso
 
 bool FglTFRuntimeParser::LoadScene(int32 SceneIndex, FglTFRuntimeScene& Scene)
 {
-	TSharedPtr<FJsonObject> JsonSceneObject = GetJsonObjectFromRootIndex("scenes", SceneIndex);
+	TSharedPtr<FJsonObject> JsonSceneObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Scenes, SceneIndex);
 	if (!JsonSceneObject)
 	{
 		return false;
@@ -1064,7 +1420,10 @@ bool FglTFRuntimeParser::LoadJointByName(const int64 RootBoneIndex, const FStrin
 void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	FString FullMessage = ErrorContext + ": " + ErrorMessage;
-	Errors.Add(FullMessage);
+	{
+		FScopeLock Lock(&ErrorsLock);
+		Errors.Add(FullMessage);
+	}
 	UE_LOG(LogGLTFRuntime, Error, TEXT("%s"), *FullMessage);
 	if (OnError.IsBound())
 	{
@@ -1074,6 +1433,7 @@ void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& Er
 
 void FglTFRuntimeParser::ClearErrors()
 {
+	FScopeLock Lock(&ErrorsLock);
 	Errors.Empty();
 }
 
@@ -1612,7 +1972,7 @@ bool FglTFRuntimeParser::LoadCameraIntoCameraComponent(const int32 CameraIndex,
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> CameraObject = GetJsonObjectFromRootIndex("cameras", CameraIndex);
+	TSharedPtr<FJsonObject> CameraObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Cameras, CameraIndex);
 	if (!CameraObject)
 	{
 		AddError("LoadCameraIntoCameraComponent()", "Invalid Camera Index.");
@@ -1694,7 +2054,7 @@ bool FglTFRuntimeParser::LoadCameraIntoCameraComponent(const int32 CameraIndex,
 
 USkeleton* FglTFRuntimeParser::LoadSkeleton(const int32 SkinIndex, const FglTFRuntimeSkeletonConfig& SkeletonConfig)
 {
-	TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex("skins", SkinIndex);
+	TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Skins, SkinIndex);
 	if (!JsonSkinObject)
 	{
 		return nullptr;
@@ -1964,13 +2324,15 @@ bool FglTFRuntimeParser::GetRootBoneIndex(TSharedRef<FJsonObject> JsonSkinObject
 	return true;
 }
 
-TMap<int32, UTexture2D*>& FglTFRuntimeParser::GetTexturesCache()
+TMap<int32, UTexture2D*> FglTFRuntimeParser::GetTexturesCache()
 {
+	FScopeLock Lock(&TexturesCacheLock);
 	return TexturesCache;
 }
 
-TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD>& FglTFRuntimeParser::GetLODsCache()
+TMap<TSharedRef<FJsonObject>, TSharedRef<FglTFRuntimeMeshLOD>> FglTFRuntimeParser::GetLODsCache()
 {
+	FScopeLock Lock(&LODsCacheLock);
 	return LODsCache;
 }
 
@@ -2414,30 +2776,33 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 	}
 
 	if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
-		{ 3 }, SupportedPositionComponentTypes, false, [&](FVector Value) -> FVector {return SceneBasis.TransformPosition(Value) * SceneScale; }, Primitive.AdditionalBufferView))
+		{ 3 }, SupportedPositionComponentTypes, false, Primitive.AdditionalBufferView))
 	{
 		AddError("LoadPrimitive()", "Unable to load POSITION attribute");
 		return false;
 	}
+	TransformPositions(Primitive.Positions);
 
 	if ((*JsonAttributesObject)->HasField("NORMAL"))
 	{
 		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
-			{ 3 }, SupportedNormalComponentTypes, false, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, Primitive.AdditionalBufferView))
+			{ 3 }, SupportedNormalComponentTypes, false, Primitive.AdditionalBufferView))
 		{
 			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
 			return false;
 		}
+		TransformNormals(Primitive.Normals);
 	}
 
 	if ((*JsonAttributesObject)->HasField("TANGENT"))
 	{
 		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents,
-			{ 4 }, SupportedTangentComponentTypes, false, [&](FVector4 Value) -> FVector4 { return SceneBasis.TransformFVector4(Value); }, Primitive.AdditionalBufferView))
+			{ 4 }, SupportedTangentComponentTypes, false, Primitive.AdditionalBufferView))
 		{
 			AddError("LoadPrimitive()", "Unable to load TANGENT attribute");
 			return false;
 		}
+		TransformTangents(Primitive.Tangents);
 	}
 
 	if ((*JsonAttributesObject)->HasField("TEXCOORD_0"))
@@ -2545,11 +2910,12 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			if (JsonTargetObject->HasField("POSITION"))
 			{
 				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "POSITION", MorphTarget.Positions,
-					{ 3 }, SupportedPositionComponentTypes, false, [&](FVector Value) -> FVector { return SceneBasis.TransformPosition(Value) * SceneScale; }, INDEX_NONE))
+					{ 3 }, SupportedPositionComponentTypes, false, INDEX_NONE))
 				{
 					AddError("LoadPrimitive()", "Unable to load POSITION attribute for MorphTarget");
 					return false;
 				}
+				TransformPositions(MorphTarget.Positions);
 				if (MorphTarget.Positions.Num() != Primitive.Positions.Num())
 				{
 					AddError("LoadPrimitive()", "Invalid POSITION attribute size for MorphTarget.");
@@ -2561,11 +2927,12 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			if (JsonTargetObject->HasField("NORMAL"))
 			{
 				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "NORMAL", MorphTarget.Normals,
-					{ 3 }, SupportedNormalComponentTypes, false, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }, INDEX_NONE))
+					{ 3 }, SupportedNormalComponentTypes, false, INDEX_NONE))
 				{
 					AddError("LoadPrimitive()", "Unable to load NORMAL attribute for MorphTarget");
 					return false;
 				}
+				TransformNormals(MorphTarget.Normals);
 				if (MorphTarget.Normals.Num() != Primitive.Normals.Num())
 				{
 					AddError("LoadPrimitive()", "Invalid NORMAL attribute size for MorphTarget.");
@@ -2585,9 +2952,11 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 	if (JsonPrimitiveObject->TryGetNumberField("indices", IndicesAccessorIndex))
 	{
 		FglTFRuntimeBlob IndicesBytes;
+		FglTFRuntimeBlob AdditionalIndicesBytes;
+		const bool bHasAdditionalIndicesBytes = GetAdditionalBufferView(Primitive.AdditionalBufferView, "indices", AdditionalIndicesBytes);
 		int64 ComponentType, Stride, Elements, ElementSize, Count;
 		bool bNormalized = false;
-		if (!GetAccessor(IndicesAccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, IndicesBytes, GetAdditionalBufferView(Primitive.AdditionalBufferView, "indices")))
+		if (!GetAccessor(IndicesAccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, IndicesBytes, bHasAdditionalIndicesBytes ? &AdditionalIndicesBytes : nullptr))
 		{
 			AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load accessor: %lld"), IndicesAccessorIndex));
 			return false;
@@ -2604,33 +2973,39 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			return false;
 		}
 
-		Primitive.Indices.AddUninitialized(Count);
-		for (int64 i = 0; i < Count; i++)
+		if (ComponentType != 5121 && ComponentType != 5123 && ComponentType != 5125)
 		{
-			int64 IndexIndex = i * Stride;
+			AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid component type for indices: %lld"), ComponentType));
+			return false;
+		}
 
-			uint32 VertexIndex;
-			if (ComponentType == 5121)
-			{
-				VertexIndex = IndicesBytes.Data[IndexIndex];
-			}
-			else if (ComponentType == 5123)
+		// the component type is checked only once, not for each index
+		Primitive.Indices.AddUninitialized(Count);
+		uint32* IndicesData = Primitive.Indices.GetData();
+		if (ComponentType == 5121)
+		{
+			for (int64 i = 0; i < Count; i++)
 			{
-				uint16* IndexPtr = (uint16*)&(IndicesBytes.Data[IndexIndex]);
-				VertexIndex = *IndexPtr;
+				IndicesData[i] = IndicesBytes.Data[i * Stride];
 			}
-			else if (ComponentType == 5125)
+		}
+		else if (ComponentType == 5123)
+		{
+			for (int64 i = 0; i < Count; i++)
 			{
-				uint32* IndexPtr = (uint32*)&(IndicesBytes.Data[IndexIndex]);
-				VertexIndex = *IndexPtr;
+				IndicesData[i] = *reinterpret_cast<const uint16*>(IndicesBytes.Data + i * Stride);
 			}
-			else
+		}
+		else if (Stride == sizeof(uint32))
+		{
+			FMemory::Memcpy(IndicesData, IndicesBytes.Data, Count * sizeof(uint32));
+		}
+		else
+		{
+			for (int64 i = 0; i < Count; i++)
 			{
-				AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid component type for indices: %lld"), ComponentType));
-				return false;
+				IndicesData[i] = *reinterpret_cast<const uint32*>(IndicesBytes.Data + i * Stride);
 			}
-
-			Primitive.Indices[i] = VertexIndex;
 		}
 	}
 	else
@@ -2748,6 +3123,136 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 }
 
 
+bool FglTFRuntimeParser::FindCachedBlob(FCriticalSection& Lock, const TMap<int32, TArray64<uint8>>& Cache, const int32 Index, FglTFRuntimeBlob& Blob, const TMap<int32, int64>* StridesCache, int64* Stride)
+{
+	FScopeLock ScopeLock(&Lock);
+	const TArray64<uint8>* CachedData = Cache.Find(Index);
+	if (!CachedData)
+	{
+		return false;
+	}
+
+	Blob.Data = const_cast<uint8*>(CachedData->GetData());
+	Blob.Num = CachedData->Num();
+	if (StridesCache && Stride)
+	{
+		*Stride = (*StridesCache)[Index];
+	}
+	return true;
+}
+
+void FglTFRuntimeParser::PublishCachedBlob(FCriticalSection& Lock, TMap<int32, TArray64<uint8>>& Cache, const int32 Index, TArray64<uint8>&& Data, FglTFRuntimeBlob& Blob, TMap<int32, int64>* StridesCache, int64* Stride)
+{
+	FScopeLock ScopeLock(&Lock);
+	// the first thread completing the decoding wins
+	const TArray64<uint8>* CachedData = Cache.Find(Index);
+	if (!CachedData)
+	{
+		CachedData = &Cache.Add(Index, MoveTemp(Data));
+		if (StridesCache && Stride)
+		{
+			StridesCache->Add(Index, *Stride);
+		}
+	}
+	else if (StridesCache && Stride)
+	{
+		*Stride = (*StridesCache)[Index];
+	}
+
+	Blob.Data = const_cast<uint8*>(CachedData->GetData());
+	Blob.Num = CachedData->Num();
+}
+
+void FglTFRuntimeParser::StartBinaryBufferStream(const int64 Size)
+{
+	BinaryBufferView = FglTFRuntimeBlob();
+	BinaryBuffer.Empty();
+	BinaryBuffer.SetNumUninitialized(Size);
+	BinaryBufferStreamSize = Size;
+	BinaryBufferStreamReceived.Set(0);
+	bBinaryBufferStreamAborted = false;
+	BinaryBufferStreamThreadId = FPlatformTLS::GetCurrentThreadId();
+}
+
+bool FglTFRuntimeParser::AppendBinaryBufferStream(const uint8* Data, const int64 Num)
+{
+	const int64 Received = BinaryBufferStreamReceived.GetValue();
+	if (Num < 0 || Received + Num > BinaryBufferStreamSize)
+	{
+		AbortBinaryBufferStream();
+		return false;
+	}
+
+	FMemory::Memcpy(BinaryBuffer.GetData() + Received, Data, Num);
+	// publish the bytes only after they have been written
+	BinaryBufferStreamReceived.Add(Num);
+	WakeUpBinaryBufferStreamWaiters();
+	return true;
+}
+
+void FglTFRuntimeParser::AbortBinaryBufferStream()
+{
+	bBinaryBufferStreamAborted = true;
+	WakeUpBinaryBufferStreamWaiters();
+}
+
+void FglTFRuntimeParser::WakeUpBinaryBufferStreamWaiters()
+{
+	// the state is checked under the lock, a waiter registered before the update is always woken up
+	FScopeLock Lock(&BinaryBufferStreamWaitersLock);
+	const int64 Received = BinaryBufferStreamReceived.GetValue();
+	for (int32 WaiterIndex = BinaryBufferStreamWaiters.Num() - 1; WaiterIndex >= 0; WaiterIndex--)
+	{
+		if (bBinaryBufferStreamAborted || BinaryBufferStreamWaiters[WaiterIndex].RangeEnd <= Received)
+		{
+			BinaryBufferStreamWaiters[WaiterIndex].Event->Trigger();
+			BinaryBufferStreamWaiters.RemoveAtSwap(WaiterIndex, 1, false);
+		}
+	}
+}
+
+bool FglTFRuntimeParser::WaitForBinaryBufferRange(const int64 RangeEnd)
+{
+	if (BinaryBufferStreamSize <= 0 || BinaryBufferStreamReceived.GetValue() >= RangeEnd)
+	{
+		return true;
+	}
+
+	// the thread feeding the stream cannot wait for itself
+	if (FPlatformTLS::GetCurrentThreadId() == BinaryBufferStreamThreadId)
+	{
+		AddError("WaitForBinaryBufferRange()", FString::Printf(TEXT("Binary chunk range up to %lld not received yet (%lld/%lld), load the asset asynchronously or after the stream has been completed"), RangeEnd, BinaryBufferStreamReceived.GetValue(), BinaryBufferStreamSize));
+		return false;
+	}
+
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_WaitForBinaryBufferRange, FColor::Magenta);
+
+	FEvent* Event = FPlatformProcess::GetSynchEventFromPool();
+	bool bWait = false;
+	{
+		FScopeLock Lock(&BinaryBufferStreamWaitersLock);
+		if (!bBinaryBufferStreamAborted && BinaryBufferStreamReceived.GetValue() < RangeEnd)
+		{
+			BinaryBufferStreamWaiters.Add({ RangeEnd, Event });
+			bWait = true;
+		}
+	}
+
+	if (bWait)
+	{
+		Event->Wait();
+	}
+	FPlatformProcess::ReturnSynchEventToPool(Event);
+
+	if (BinaryBufferStreamReceived.GetValue() < RangeEnd)
+	{
+		AddError("WaitForBinaryBufferRange()", "Binary chunk stream aborted");
+		return false;
+	}
+
+	return true;
+}
+
 bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 {
 	if (Index < 0)
@@ -2755,6 +3260,12 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return false;
 	}
 
+	if (Index == 0 && BinaryBufferView.Num > 0)
+	{
+		Blob = BinaryBufferView;
+		return true;
+	}
+
 	if (Index == 0 && BinaryBuffer.Num() > 0)
 	{
 		Blob.Data = BinaryBuffer.GetData();
@@ -2763,38 +3274,32 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	}
 
 	// first check cache
-	if (BuffersCache.Contains(Index))
+	if (FindCachedBlob(BuffersCacheLock, BuffersCache, Index, Blob))
 	{
-		Blob.Data = BuffersCache[Index].GetData();
-		Blob.Num = BuffersCache[Index].Num();
 		return true;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
-
-	// no buffers ?
-	if (!Root->TryGetArrayField("buffers", JsonBuffers))
 	{
-		return false;
+		FScopeLock Lock(&BuffersCacheLock);
+		if (const FglTFRuntimeZipEntryContent* ZipContent = ZipBuffersCache.Find(Index))
+		{
+			Blob.Data = const_cast<uint8*>(ZipContent->Data);
+			Blob.Num = ZipContent->Num;
+			return true;
+		}
 	}
 
-	if (Index >= JsonBuffers->Num())
+	if (Index >= Document.BuffersByteLength.Num() || Document.BuffersByteLength[Index] < 0)
 	{
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonBufferObject = (*JsonBuffers)[Index]->AsObject();
+	TSharedPtr<FJsonObject> JsonBufferObject = GetJsonObjectFromIndex(Root, "buffers", Index);
 	if (!JsonBufferObject)
 	{
 		return false;
 	}
 
-	int64 ByteLength;
-	if (!JsonBufferObject->TryGetNumberField("byteLength", ByteLength))
-	{
-		return false;
-	}
-
 	FString Uri;
 	if (!JsonBufferObject->TryGetStringField("uri", Uri))
 	{
@@ -2807,9 +3312,7 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		TArray64<uint8> Base64Data;
 		if (ParseBase64Uri(Uri, Base64Data))
 		{
-			BuffersCache.Add(Index, Base64Data);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			PublishCachedBlob(BuffersCacheLock, BuffersCache, Index, MoveTemp(Base64Data), Blob);
 			return true;
 		}
 		return false;
@@ -2817,12 +3320,18 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 
 	if (ZipFile)
 	{
-		TArray64<uint8> ZipData;
-		if (ZipFile->GetFileContent(Uri, ZipData))
+		// shared with the archive cache, no copy
+		FglTFRuntimeZipEntryContent ZipContent;
+		if (ZipFile->GetFileContent(Uri, ZipContent))
 		{
-			BuffersCache.Add(Index, ZipData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			FScopeLock Lock(&BuffersCacheLock);
+			const FglTFRuntimeZipEntryContent* CachedContent = ZipBuffersCache.Find(Index);
+			if (!CachedContent)
+			{
+				CachedContent = &ZipBuffersCache.Add(Index, MoveTemp(ZipContent));
+			}
+			Blob.Data = const_cast<uint8*>(CachedContent->Data);
+			Blob.Num = CachedContent->Num;
 			return true;
 		}
 	}
@@ -2833,9 +3342,7 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		TArray64<uint8> FileData;
 		if (FFileHelper::LoadFileToArray(FileData, *FPaths::Combine(BaseDirectory, Uri)))
 		{
-			BuffersCache.Add(Index, FileData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
+			PublishCachedBlob(BuffersCacheLock, BuffersCache, Index, MoveTemp(FileData), Blob);
 			return true;
 		}
 	}
@@ -2844,6 +3351,90 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 	return false;
 }
 
+bool FglTFRuntimeParser::DecodeBase64(const TCHAR* Source, int64 SourceLength, TArray64<uint8>& Bytes)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecodeBase64, FColor::Magenta);
+
+	// 0xFF marks invalid characters
+	static const struct FBase64DecodingTable
+	{
+		uint8 Values[256];
+		FBase64DecodingTable()
+		{
+			FMemory::Memset(Values, 0xFF, 256);
+			const ANSICHAR* Alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+			for (uint8 Index = 0; Index < 64; Index++)
+			{
+				Values[(uint8)Alphabet[Index]] = Index;
+			}
+		}
+	} DecodingTable;
+
+	// strip padding
+	while (SourceLength > 0 && Source[SourceLength - 1] == '=')
+	{
+		SourceLength--;
+	}
+
+	const int64 Remainder = SourceLength % 4;
+	if (Remainder == 1)
+	{
+		return false;
+	}
+
+	const int64 Quads = SourceLength / 4;
+	const int64 DecodedLength = Quads * 3 + (Remainder > 0 ? Remainder - 1 : 0);
+
+	const int64 StartOffset = Bytes.Num();
+	Bytes.AddUninitialized(DecodedLength);
+	uint8* Output = Bytes.GetData() + StartOffset;
+
+	auto Lookup = [&DecodingTable](const TCHAR Char) -> uint32
+	{
+		return Char < 256 ? DecodingTable.Values[Char] : 0xFF;
+	};
+
+	for (int64 QuadIndex = 0; QuadIndex < Quads; QuadIndex++)
+	{
+		const uint32 A = Lookup(Source[0]);
+		const uint32 B = Lookup(Source[1]);
+		const uint32 C = Lookup(Source[2]);
+		const uint32 D = Lookup(Source[3]);
+		// a single check for the four characters
+		if ((A | B | C | D) & 0x80)
+		{
+			Bytes.SetNum(StartOffset, false);
+			return false;
+		}
+		const uint32 Triple = (A << 18) | (B << 12) | (C << 6) | D;
+		Output[0] = (uint8)(Triple >> 16);
+		Output[1] = (uint8)(Triple >> 8);
+		Output[2] = (uint8)Triple;
+		Source += 4;
+		Output += 3;
+	}
+
+	if (Remainder > 0)
+	{
+		const uint32 A = Lookup(Source[0]);
+		const uint32 B = Lookup(Source[1]);
+		const uint32 C = Remainder > 2 ? Lookup(Source[2]) : 0;
+		if ((A | B | C) & 0x80)
+		{
+			Bytes.SetNum(StartOffset, false);
+			return false;
+		}
+		const uint32 Triple = (A << 18) | (B << 12) | (C << 6);
+		Output[0] = (uint8)(Triple >> 16);
+		if (Remainder > 2)
+		{
+			Output[1] = (uint8)(Triple >> 8);
+		}
+	}
+
+	return true;
+}
+
 bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes)
 {
 	const FString Base64Signature = ";base64,";
@@ -2855,19 +3446,44 @@ bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Byt
 
 	StringIndex += Base64Signature.Len();
 
-	TArray<uint8> BytesBase64;
-
-	bool bSuccess = FBase64::Decode(Uri.Mid(StringIndex), BytesBase64);
-	if (bSuccess)
-	{
-		Bytes.Append(BytesBase64);
-	}
-	return bSuccess;
+	// decode in place from the uri string, no intermediate copies
+	return DecodeBase64(*Uri + StringIndex, Uri.Len() - StringIndex, Bytes);
 }
 
 bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob, int64& Stride)
 {
-	TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex("bufferViews", Index);
+	if (Index < 0 || Index >= Document.BufferViewsBuffer.Num())
+	{
+		return false;
+	}
+
+	if (!Document.BufferViewsCompressed[Index])
+	{
+		FglTFRuntimeBlob BufferBlob;
+		if (!GetBuffer(Document.BufferViewsBuffer[Index], BufferBlob))
+		{
+			return false;
+		}
+
+		const int64 ByteOffset = Document.BufferViewsByteOffset[Index];
+		const int64 ByteLength = Document.BufferViewsByteLength[Index];
+		if (ByteLength < 0 || ByteOffset + ByteLength > BufferBlob.Num)
+		{
+			return false;
+		}
+
+		if (Document.BufferViewsBuffer[Index] == 0 && !WaitForBinaryBufferRange(ByteOffset + ByteLength))
+		{
+			return false;
+		}
+
+		Stride = Document.BufferViewsByteStride[Index];
+		Blob.Data = BufferBlob.Data + ByteOffset;
+		Blob.Num = ByteLength;
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::BufferViews, Index);
 	if (!JsonBufferViewObject)
 	{
 		return false;
@@ -2877,11 +3493,8 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 	if (JsonBufferViewCompressedObject)
 	{
 		JsonBufferViewObject = JsonBufferViewCompressedObject;
-		if (CompressedBufferViewsCache.Contains(Index))
+		if (FindCachedBlob(CompressedBufferViewsCacheLock, CompressedBufferViewsCache, Index, Blob, &CompressedBufferViewsStridesCache, &Stride))
 		{
-			Blob.Data = CompressedBufferViewsCache[Index].GetData();
-			Blob.Num = CompressedBufferViewsCache[Index].Num();
-			Stride = CompressedBufferViewsStridesCache[Index];
 			return true;
 		}
 	}
@@ -2920,6 +3533,11 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 		return false;
 	}
 
+	if (BufferIndex == 0 && !WaitForBinaryBufferRange(ByteOffset + ByteLength))
+	{
+		return false;
+	}
+
 	Blob.Data = BufferBlob.Data + ByteOffset;
 	Blob.Num = ByteLength;
 
@@ -2946,15 +3564,12 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 			MeshOptFilter = "NONE";
 		}
 
-		CompressedBufferViewsCache.Add(Index);
-		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, CompressedBufferViewsCache[Index]))
+		TArray64<uint8> UncompressedBytes;
+		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, UncompressedBytes))
 		{
-			CompressedBufferViewsCache.Remove(Index);
 			return false;
 		}
-		Blob.Data = CompressedBufferViewsCache[Index].GetData();
-		Blob.Num = CompressedBufferViewsCache[Index].Num();
-		CompressedBufferViewsStridesCache.Add(Index, Stride);
+		PublishCachedBlob(CompressedBufferViewsCacheLock, CompressedBufferViewsCache, Index, MoveTemp(UncompressedBytes), Blob, &CompressedBufferViewsStridesCache, &Stride);
 	}
 
 	return true;
@@ -2963,55 +3578,33 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView)
 {
 
-	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", Index);
-	if (!JsonAccessorObject)
+	if (Index < 0 || Index >= Document.AccessorsComponentType.Num())
 	{
 		return false;
 	}
 
 	bool bInitWithZeros = false;
-	bool bHasSparse = false;
+	const bool bHasSparse = Document.AccessorsSparse[Index];
 
 	int64 BufferViewIndex = INDEX_NONE;
 	int64 ByteOffset = 0;
 
 	if (!AdditionalBufferView)
 	{
-		if (!JsonAccessorObject->TryGetNumberField("bufferView", BufferViewIndex))
+		BufferViewIndex = Document.AccessorsBufferView[Index];
+		if (BufferViewIndex == INDEX_NONE)
 		{
 			bInitWithZeros = true;
 		}
 
-
-		if (!JsonAccessorObject->TryGetNumberField("byteOffset", ByteOffset))
-		{
-			ByteOffset = 0;
-		}
-	}
-
-	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
-	if (JsonAccessorObject->TryGetObjectField("sparse", JsonSparseObject))
-	{
-		bHasSparse = true;
-	}
-
-	if (!JsonAccessorObject->TryGetBoolField("normalized", bNormalized))
-	{
-		bNormalized = false;
-	}
-
-	if (!JsonAccessorObject->TryGetNumberField("componentType", ComponentType))
-	{
-		return false;
+		ByteOffset = Document.AccessorsByteOffset[Index];
 	}
 
-	if (!JsonAccessorObject->TryGetNumberField("count", Count))
-	{
-		return false;
-	}
+	bNormalized = Document.AccessorsNormalized[Index];
+	ComponentType = Document.AccessorsComponentType[Index];
 
-	FString Type;
-	if (!JsonAccessorObject->TryGetStringField("type", Type))
+	Count = Document.AccessorsCount[Index];
+	if (Count < 0)
 	{
 		return false;
 	}
@@ -3022,7 +3615,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		return false;
 	}
 
-	Elements = GetTypeSize(Type);
+	Elements = Document.AccessorsElements[Index];
 	if (Elements == 0)
 	{
 		return false;
@@ -3047,11 +3640,16 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	else if (bInitWithZeros)
 	{
 
-		if (ZeroBuffer.Num() < FinalSize)
 		{
-			ZeroBuffer.AddZeroed(FinalSize - ZeroBuffer.Num());
+			FScopeLock Lock(&ZeroBufferLock);
+			if (ZeroBuffers.Num() == 0 || ZeroBuffers.Last()->Num() < FinalSize)
+			{
+				TUniquePtr<TArray64<uint8>> NewZeroBuffer = MakeUnique<TArray64<uint8>>();
+				NewZeroBuffer->AddZeroed(FinalSize);
+				ZeroBuffers.Add(MoveTemp(NewZeroBuffer));
+			}
+			Blob.Data = ZeroBuffers.Last()->GetData();
 		}
-		Blob.Data = ZeroBuffer.GetData();
 		Blob.Num = FinalSize;
 		if (!bHasSparse)
 		{
@@ -3097,14 +3695,23 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		}
 	}
 
-	if (SparseAccessorsCache.Contains(Index))
+	if (FindCachedBlob(SparseAccessorsCacheLock, SparseAccessorsCache, Index, Blob, &SparseAccessorsStridesCache, &Stride))
 	{
-		Stride = SparseAccessorsStridesCache[Index];
-		Blob.Data = SparseAccessorsCache[Index].GetData();
-		Blob.Num = SparseAccessorsCache[Index].Num();
 		return true;
 	}
 
+	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Accessors, Index);
+	if (!JsonAccessorObject)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
+	if (!JsonAccessorObject->TryGetObjectField("sparse", JsonSparseObject))
+	{
+		return false;
+	}
+
 	int64 SparseCount;
 	if (!(*JsonSparseObject)->TryGetNumberField("count", SparseCount))
 	{
@@ -3219,9 +3826,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 
 	Stride = SparseBufferViewValuesStride;
 
-	SparseAccessorsCache.Add(Index);
-	SparseAccessorsStridesCache.Add(Index, Stride);
-	TArray64<uint8>& SparseData = SparseAccessorsCache[Index];
+	TArray64<uint8> SparseData;
 	SparseData.Append(Blob.Data, Blob.Num);
 
 	for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
@@ -3237,7 +3842,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
 	}
 
-	Blob.Data = SparseData.GetData();
+	PublishCachedBlob(SparseAccessorsCacheLock, SparseAccessorsCache, Index, MoveTemp(SparseData), Blob, &SparseAccessorsStridesCache, &Stride);
 
 	return true;
 }
@@ -3287,11 +3892,20 @@ int64 FglTFRuntimeParser::GetTypeSize(const FString& Type) const
 
 void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 {
-	Collector.AddReferencedObjects(StaticMeshesCache);
-	Collector.AddReferencedObjects(MaterialsCache);
+	{
+		FScopeLock Lock(&StaticMeshesCacheLock);
+		Collector.AddReferencedObjects(StaticMeshesCache);
+	}
+	{
+		FScopeLock Lock(&MaterialsCacheLock);
+		Collector.AddReferencedObjects(MaterialsCache);
+	}
 	Collector.AddReferencedObjects(SkeletonsCache);
 	Collector.AddReferencedObjects(SkeletalMeshesCache);
-	Collector.AddReferencedObjects(TexturesCache);
+	{
+		FScopeLock Lock(&TexturesCacheLock);
+		Collector.AddReferencedObjects(TexturesCache);
+	}
 	Collector.AddReferencedObjects(MetallicRoughnessMaterialsMap);
 	Collector.AddReferencedObjects(SpecularGlossinessMaterialsMap);
 	Collector.AddReferencedObjects(UnlitMaterialsMap);
@@ -3440,7 +4054,7 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 
 bool FglTFRuntimeParser::GetMorphTargetNames(const int32 MeshIndex, TArray<FName>& MorphTargetNames)
 {
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		AddError("GetMorphTargetNames()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -3512,23 +4126,59 @@ bool FglTFRuntimeParser::GetMorphTargetNames(const int32 MeshIndex, TArray<FName
 
 bool FglTFRuntimeZipFile::FromData(const uint8* DataPtr, const int64 DataNum)
 {
-	Data.Append(DataPtr, DataNum);
+	TArray64<uint8> InData;
+	InData.Append(DataPtr, DataNum);
+	return FromData(MoveTemp(InData));
+}
+
+bool FglTFRuntimeZipFile::FromData(TArray64<uint8>&& InData)
+{
+	OwnedData = MoveTemp(InData);
+	Data = OwnedData.GetData();
+	DataNum = OwnedData.Num();
+	return ParseCentralDirectory();
+}
 
-	// step0: retrieve the trailer magic
-	TArray<uint8> Magic;
+bool FglTFRuntimeZipFile::FromDataView(const uint8* DataPtr, const int64 InDataNum, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
+{
+	MappedFile = InMappedFile;
+	Data = DataPtr;
+	DataNum = InDataNum;
+	return ParseCentralDirectory();
+}
+
+template<typename T>
+static FORCEINLINE T glTFRuntimeZipRead(const uint8* Ptr)
+{
+	T Value;
+	FMemory::Memcpy(&Value, Ptr, sizeof(T));
+	return Value;
+}
+
+bool FglTFRuntimeZipFile::ParseCentralDirectory()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeZipFile_ParseCentralDirectory, FColor::Magenta);
+
+	constexpr int64 TrailerMinSize = 22;
+	constexpr int64 CentralDirectoryMinSize = 46;
+	constexpr int64 Zip64LocatorSize = 20;
+	constexpr int64 Zip64TrailerMinSize = 56;
+
+	if (DataNum < TrailerMinSize)
+	{
+		return false;
+	}
+
+	// step0: retrieve the trailer magic, it can only be in the last 64k + trailer bytes (comment max size)
+	int64 Index = DataNum - TrailerMinSize;
+	const int64 SearchLimit = FMath::Max<int64>(0, DataNum - TrailerMinSize - MAX_uint16);
 	bool bIndexFound = false;
-	uint64 Index = 0;
-	for (Index = Data.Num() - 1; Index >= 0; Index--)
+	for (; Index >= SearchLimit; Index--)
 	{
-		Magic.Insert(Data[Index], 0);
-		if (Magic.Num() == 4)
+		if (Data[Index] == 0x50 && Data[Index + 1] == 0x4b && Data[Index + 2] == 0x05 && Data[Index + 3] == 0x06)
 		{
-			if (Magic[0] == 0x50 && Magic[1] == 0x4b && Magic[2] == 0x05 && Magic[3] == 0x06)
-			{
-				bIndexFound = true;
-				break;
-			}
-			Magic.Pop();
+			bIndexFound = true;
+			break;
 		}
 	}
 
@@ -3537,63 +4187,84 @@ bool FglTFRuntimeZipFile::FromData(const uint8* DataPtr, const int64 DataNum)
 		return false;
 	}
 
-	uint16 DiskEntries = 0;
-	uint16 TotalEntries = 0;
-	uint32 CentralDirectorySize = 0;
-	uint32 CentralDirectoryOffset = 0;
-	uint16 CommentLen = 0;
-
-	constexpr uint64 TrailerMinSize = 22;
-	constexpr uint64 CentralDirectoryMinSize = 46;
+	uint64 DiskEntries = glTFRuntimeZipRead<uint16>(Data + Index + 8);
+	uint64 TotalEntries = glTFRuntimeZipRead<uint16>(Data + Index + 10);
+	uint64 CentralDirectorySize = glTFRuntimeZipRead<uint32>(Data + Index + 12);
+	uint64 CentralDirectoryOffset = glTFRuntimeZipRead<uint32>(Data + Index + 16);
 
-	if (Index + TrailerMinSize > Data.Num())
+	// ZIP64 ?
+	if (Index >= Zip64LocatorSize && glTFRuntimeZipRead<uint32>(Data + Index - Zip64LocatorSize) == 0x07064b50)
 	{
-		return false;
+		const uint64 Zip64TrailerOffset = glTFRuntimeZipRead<uint64>(Data + Index - Zip64LocatorSize + 8);
+		if (Zip64TrailerOffset + Zip64TrailerMinSize > (uint64)DataNum || glTFRuntimeZipRead<uint32>(Data + Zip64TrailerOffset) != 0x06064b50)
+		{
+			return false;
+		}
+		DiskEntries = glTFRuntimeZipRead<uint64>(Data + Zip64TrailerOffset + 24);
+		TotalEntries = glTFRuntimeZipRead<uint64>(Data + Zip64TrailerOffset + 32);
+		CentralDirectorySize = glTFRuntimeZipRead<uint64>(Data + Zip64TrailerOffset + 40);
+		CentralDirectoryOffset = glTFRuntimeZipRead<uint64>(Data + Zip64TrailerOffset + 48);
 	}
 
-	// skip signature and disk data
-	Data.Seek(Index + 8);
-	Data << DiskEntries;
-	Data << TotalEntries;
-	Data << CentralDirectorySize;
-	Data << CentralDirectoryOffset;
-	Data << CommentLen;
+	const uint64 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
 
-	uint16 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
+	EntriesMap.Reserve(DirectoryEntries);
 
-	for (uint16 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
+	for (uint64 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
 	{
-		if (CentralDirectoryOffset + CentralDirectoryMinSize > Data.Num())
+		if (CentralDirectoryOffset + CentralDirectoryMinSize > (uint64)DataNum)
 		{
 			return false;
 		}
 
-		uint16 FilenameLen = 0;
-		uint16 ExtraFieldLen = 0;
-		uint16 EntryCommentLen = 0;
-		uint32 EntryOffset = 0;
+		const uint8* EntryPtr = Data + CentralDirectoryOffset;
 
-		// seek to FilenameLen
-		Data.Seek(CentralDirectoryOffset + 28);
-		Data << FilenameLen;
-		Data << ExtraFieldLen;
-		Data << EntryCommentLen;
-		// seek to EntryOffset
-		Data.Seek(CentralDirectoryOffset + 42);
-		Data << EntryOffset;
+		FEntry Entry;
+		Entry.Compression = glTFRuntimeZipRead<uint16>(EntryPtr + 10);
+		Entry.CompressedSize = glTFRuntimeZipRead<uint32>(EntryPtr + 20);
+		Entry.UncompressedSize = glTFRuntimeZipRead<uint32>(EntryPtr + 24);
+		const uint16 FilenameLen = glTFRuntimeZipRead<uint16>(EntryPtr + 28);
+		const uint16 ExtraFieldLen = glTFRuntimeZipRead<uint16>(EntryPtr + 30);
+		const uint16 EntryCommentLen = glTFRuntimeZipRead<uint16>(EntryPtr + 32);
+		Entry.LocalHeaderOffset = glTFRuntimeZipRead<uint32>(EntryPtr + 42);
 
-		if (CentralDirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > Data.Num())
+		if (CentralDirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > (uint64)DataNum)
 		{
 			return false;
 		}
 
-		TArray64<uint8> FilenameBytes;
-		FilenameBytes.Append(Data.GetData() + CentralDirectoryOffset + CentralDirectoryMinSize, FilenameLen);
-		FilenameBytes.Add(0);
-
-		FString Filename = FString(UTF8_TO_TCHAR(FilenameBytes.GetData()));
+		// ZIP64 extended information, only the saturated fields are present
+		const uint8* ExtraPtr = EntryPtr + CentralDirectoryMinSize + FilenameLen;
+		const uint8* ExtraEnd = ExtraPtr + ExtraFieldLen;
+		while (ExtraPtr + 4 <= ExtraEnd)
+		{
+			const uint16 HeaderId = glTFRuntimeZipRead<uint16>(ExtraPtr);
+			const uint16 HeaderSize = glTFRuntimeZipRead<uint16>(ExtraPtr + 2);
+			const uint8* FieldPtr = ExtraPtr + 4;
+			const uint8* FieldEnd = FMath::Min(FieldPtr + HeaderSize, ExtraEnd);
+			if (HeaderId == 0x0001)
+			{
+				if (Entry.UncompressedSize == MAX_uint32 && FieldPtr + 8 <= FieldEnd)
+				{
+					Entry.UncompressedSize = glTFRuntimeZipRead<uint64>(FieldPtr);
+					FieldPtr += 8;
+				}
+				if (Entry.CompressedSize == MAX_uint32 && FieldPtr + 8 <= FieldEnd)
+				{
+					Entry.CompressedSize = glTFRuntimeZipRead<uint64>(FieldPtr);
+					FieldPtr += 8;
+				}
+				if (Entry.LocalHeaderOffset == MAX_uint32 && FieldPtr + 8 <= FieldEnd)
+				{
+					Entry.LocalHeaderOffset = glTFRuntimeZipRead<uint64>(FieldPtr);
+				}
+				break;
+			}
+			ExtraPtr += 4 + HeaderSize;
+		}
 
-		OffsetsMap.Add(Filename, EntryOffset);
+		FUTF8ToTCHAR FilenameConverter(reinterpret_cast<const ANSICHAR*>(EntryPtr + CentralDirectoryMinSize), FilenameLen);
+		EntriesMap.Add(FString(FilenameConverter.Length(), FilenameConverter.Get()), Entry);
 
 		CentralDirectoryOffset += CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen;
 	}
@@ -3601,53 +4272,263 @@ bool FglTFRuntimeZipFile::FromData(const uint8* DataPtr, const int64 DataNum)
 	return true;
 }
 
-bool FglTFRuntimeZipFile::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
+const uint8* FglTFRuntimeZipFile::GetEntryData(const FEntry& Entry) const
 {
-	uint32* Offset = OffsetsMap.Find(Filename);
-	if (!Offset)
+	constexpr uint64 LocalEntryMinSize = 30;
+
+	// zip64 sizes and offsets are untrusted, compare with the remaining bytes so that nothing can wrap around
+	if (Entry.LocalHeaderOffset > (uint64)DataNum || LocalEntryMinSize > (uint64)DataNum - Entry.LocalHeaderOffset)
+	{
+		return nullptr;
+	}
+
+	// local extra field can be different from the central directory one
+	const uint16 FilenameLen = glTFRuntimeZipRead<uint16>(Data + Entry.LocalHeaderOffset + 26);
+	const uint16 ExtraFieldLen = glTFRuntimeZipRead<uint16>(Data + Entry.LocalHeaderOffset + 28);
+
+	const uint64 EntryDataOffset = Entry.LocalHeaderOffset + LocalEntryMinSize + FilenameLen + ExtraFieldLen;
+	if (EntryDataOffset > (uint64)DataNum || Entry.CompressedSize > (uint64)DataNum - EntryDataOffset)
+	{
+		return nullptr;
+	}
+
+	return Data + EntryDataOffset;
+}
+
+bool FglTFRuntimeZipFile::Inflate(const uint8* Source, const int64 SourceNum, uint8* Dest, const int64 DestNum)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeZipFile_Inflate, FColor::Magenta);
+
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	if (inflateInit2(&Stream, -MAX_WBITS) != Z_OK)
 	{
 		return false;
 	}
 
-	constexpr uint64 LocalEntryMinSize = 30;
+	// zlib counters are 32 bit, feed the stream in slices
+	constexpr int64 SliceSize = 1024 * 1024 * 1024;
+	int64 SourceOffset = 0;
+	int64 DestOffset = 0;
+	int32 Result = Z_OK;
+	while (Result == Z_OK)
+	{
+		if (Stream.avail_in == 0 && SourceOffset < SourceNum)
+		{
+			const int64 Slice = FMath::Min(SourceNum - SourceOffset, SliceSize);
+			Stream.next_in = const_cast<Bytef*>(Source + SourceOffset);
+			Stream.avail_in = (uInt)Slice;
+			SourceOffset += Slice;
+		}
+
+		if (Stream.avail_out == 0 && DestOffset < DestNum)
+		{
+			const int64 Slice = FMath::Min(DestNum - DestOffset, SliceSize);
+			Stream.next_out = Dest + DestOffset;
+			Stream.avail_out = (uInt)Slice;
+			DestOffset += Slice;
+		}
+
+		Result = inflate(&Stream, Z_NO_FLUSH);
+	}
+
+	const int64 Written = DestOffset - Stream.avail_out;
+	inflateEnd(&Stream);
+
+	return Result == Z_STREAM_END && Written == DestNum;
+}
+
+void FglTFRuntimeZipFile::AddToCache(const FString& Filename, const TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>& Content)
+{
+	if (Cache.Contains(Filename))
+	{
+		return;
+	}
+
+	// would evict everything else, only the last one is kept
+	if (Content->Num() > CacheMaxSize)
+	{
+		OversizeFilename = Filename;
+		OversizeContent = Content;
+		return;
+	}
+
+	// evicted entries stay alive while someone still references them
+	while (CacheSize + Content->Num() > CacheMaxSize && CacheOrder.Num() > 0)
+	{
+		TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Evicted;
+		if (Cache.RemoveAndCopyValue(CacheOrder[0], Evicted))
+		{
+			CacheSize -= Evicted->Num();
+		}
+		CacheOrder.RemoveAt(0);
+	}
+
+	Cache.Add(Filename, Content);
+	CacheOrder.Add(Filename);
+	CacheSize += Content->Num();
+}
+
+FglTFRuntimeZipFile::~FglTFRuntimeZipFile()
+{
+	// in flight prefetches reference the archive memory and the cache
+	for (const TPair<FString, TSharedRef<FPrefetch, ESPMode::ThreadSafe>>& Pair : Prefetching)
+	{
+		Pair.Value->Future.Wait();
+	}
+}
+
+void FglTFRuntimeZipFile::Prefetch(const TArray<FString>& Filenames)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeZipFile_Prefetch, FColor::Magenta);
+
+	FScopeLock Lock(&CacheLock);
+
+	// completed tasks can be forgotten
+	for (TMap<FString, TSharedRef<FPrefetch, ESPMode::ThreadSafe>>::TIterator It = Prefetching.CreateIterator(); It; ++It)
+	{
+		if (It->Value->Future.IsReady())
+		{
+			It.RemoveCurrent();
+		}
+	}
 
-	if (*Offset + LocalEntryMinSize > Data.Num())
+	// do not inflate more than the cache can hold, it would be evicted before being used
+	int64 PrefetchSize = CacheSize;
+
+	for (const FString& Filename : Filenames)
+	{
+		const FEntry* Entry = EntriesMap.Find(Filename);
+		if (!Entry || Entry->Compression != 8 || Entry->UncompressedSize == 0 || Cache.Contains(Filename) || Prefetching.Contains(Filename))
+		{
+			continue;
+		}
+
+		if (PrefetchSize + (int64)Entry->UncompressedSize > CacheMaxSize)
+		{
+			continue;
+		}
+		PrefetchSize += Entry->UncompressedSize;
+
+		// the task starts under CacheLock, so it cannot run before being tracked
+		TSharedRef<FPrefetch, ESPMode::ThreadSafe> PrefetchState = MakeShared<FPrefetch, ESPMode::ThreadSafe>();
+		PrefetchState->Future = Async(EAsyncExecution::ThreadPool, [this, Filename, Entry, PrefetchState]()
+			{
+				{
+					FScopeLock Lock(&CacheLock);
+					if (PrefetchState->bClaimed)
+					{
+						return false;
+					}
+					PrefetchState->bStarted = true;
+				}
+
+				TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> Inflated = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>();
+				Inflated->AddUninitialized(Entry->UncompressedSize);
+				const uint8* EntryData = GetEntryData(*Entry);
+				if (!EntryData || !Inflate(EntryData, Entry->CompressedSize, Inflated->GetData(), Inflated->Num()))
+				{
+					return false;
+				}
+
+				FScopeLock Lock(&CacheLock);
+				// moved, not copied
+				AddToCache(Filename, Inflated);
+				return true;
+			}).Share();
+		Prefetching.Add(Filename, PrefetchState);
+	}
+}
+
+bool FglTFRuntimeZipFile::GetFileContent(const FString& Filename, FglTFRuntimeZipEntryContent& OutContent)
+{
+	const FEntry* Entry = EntriesMap.Find(Filename);
+	if (!Entry)
 	{
 		return false;
 	}
 
-	uint16 Compression = 0;
-	uint32 CompressedSize;
-	uint32 UncompressedSize = 0;
-	uint16 FilenameLen = 0;
-	uint16 ExtraFieldLen = 0;
+	OutContent = FglTFRuntimeZipEntryContent();
+
+	// nothing to inflate
+	if (Entry->UncompressedSize == 0)
+	{
+		return Entry->Compression == 0 || Entry->Compression == 8;
+	}
+
+	TSharedFuture<bool> PrefetchFuture;
+	{
+		FScopeLock Lock(&CacheLock);
+		if (const TSharedRef<FPrefetch, ESPMode::ThreadSafe>* Prefetch = Prefetching.Find(Filename))
+		{
+			// the caller can be a pool task too: never wait for a task that could still be queued behind it
+			if ((*Prefetch)->bStarted)
+			{
+				PrefetchFuture = (*Prefetch)->Future;
+			}
+			else
+			{
+				(*Prefetch)->bClaimed = true;
+			}
+		}
+	}
+
+	// wait for the running prefetch instead of inflating the entry twice
+	if (PrefetchFuture.IsValid())
+	{
+		PrefetchFuture.Wait();
+	}
+
+	{
+		FScopeLock Lock(&CacheLock);
+
+		if (PrefetchFuture.IsValid())
+		{
+			Prefetching.Remove(Filename);
+		}
+
+		const TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>* CachedContent = Cache.Find(Filename);
+		if (!CachedContent && OversizeContent.IsValid() && OversizeFilename == Filename)
+		{
+			CachedContent = &OversizeContent;
+		}
 
-	// seek to Compression
-	Data.Seek(*Offset + 8);
-	Data << Compression;
-	// seek to CompressedSize
-	Data.Seek(*Offset + 18);
-	Data << CompressedSize;
-	Data << UncompressedSize;
-	Data << FilenameLen;
-	Data << ExtraFieldLen;
+		if (CachedContent)
+		{
+			OutContent.Data = (*CachedContent)->GetData();
+			OutContent.Num = (*CachedContent)->Num();
+			OutContent.Owner = *CachedContent;
+			return true;
+		}
+	}
 
-	if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize > Data.Num())
+	const uint8* EntryData = GetEntryData(*Entry);
+	if (!EntryData)
 	{
 		return false;
 	}
 
-	if (Compression == 8)
+	if (Entry->Compression == 8)
 	{
-		OutData.AddUninitialized(UncompressedSize);
-		if (!FCompression::UncompressMemory(NAME_Zlib, OutData.GetData(), UncompressedSize, Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen, CompressedSize, COMPRESS_NoFlags, -15))
+		TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> Inflated = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>();
+		Inflated->AddUninitialized(Entry->UncompressedSize);
+		if (!Inflate(EntryData, Entry->CompressedSize, Inflated->GetData(), Inflated->Num()))
 		{
 			return false;
 		}
+
+		OutContent.Data = Inflated->GetData();
+		OutContent.Num = Inflated->Num();
+		OutContent.Owner = Inflated;
+
+		FScopeLock Lock(&CacheLock);
+		AddToCache(Filename, OutContent.Owner);
 	}
-	else if (Compression == 0 && CompressedSize == UncompressedSize)
+	else if (Entry->Compression == 0 && Entry->CompressedSize == Entry->UncompressedSize)
 	{
-		OutData.Append(Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen, UncompressedSize);
+		// stored entries are a view of the archive
+		OutContent.Data = EntryData;
+		OutContent.Num = Entry->UncompressedSize;
 	}
 	else
 	{
@@ -3657,14 +4538,26 @@ bool FglTFRuntimeZipFile::GetFileContent(const FString& Filename, TArray64<uint8
 	return true;
 }
 
+bool FglTFRuntimeZipFile::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
+{
+	FglTFRuntimeZipEntryContent Content;
+	if (!GetFileContent(Filename, Content))
+	{
+		return false;
+	}
+
+	OutData.Append(Content.Data, Content.Num);
+	return true;
+}
+
 bool FglTFRuntimeZipFile::FileExists(const FString& Filename) const
 {
-	return OffsetsMap.Contains(Filename);
+	return EntriesMap.Contains(Filename);
 }
 
 FString FglTFRuntimeZipFile::GetFirstFilenameByExtension(const FString& Extension) const
 {
-	for (const TPair<FString, uint32>& Pair : OffsetsMap)
+	for (const TPair<FString, FEntry>& Pair : EntriesMap)
 	{
 		if (Pair.Key.EndsWith(Extension, ESearchCase::IgnoreCase))
 		{
@@ -3675,6 +4568,36 @@ FString FglTFRuntimeZipFile::GetFirstFilenameByExtension(const FString& Extensio
 	return "";
 }
 
+void FglTFRuntimeParser::PrefetchArchiveEntries()
+{
+	if (!ZipFile)
+	{
+		return;
+	}
+
+	TArray<FString> Filenames;
+	for (const FString& FieldName : { FString("buffers"), FString("images") })
+	{
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (!Root->TryGetArrayField(FieldName, JsonArray))
+		{
+			continue;
+		}
+
+		for (const TSharedPtr<FJsonValue>& JsonValue : *JsonArray)
+		{
+			const TSharedPtr<FJsonObject>* JsonObject = nullptr;
+			FString Uri;
+			if (JsonValue->TryGetObject(JsonObject) && (*JsonObject)->TryGetStringField("uri", Uri) && !Uri.StartsWith("data:") && ZipFile->FileExists(Uri))
+			{
+				Filenames.AddUnique(Uri);
+			}
+		}
+	}
+
+	ZipFile->Prefetch(Filenames);
+}
+
 bool FglTFRuntimeParser::GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject, TArray64<uint8>& Bytes)
 {
 	FString Uri;
@@ -3833,27 +4756,30 @@ int64 FglTFRuntimeParser::GetJsonObjectIndex(TSharedRef<FJsonObject> JsonObject,
 	return INDEX_NONE;
 }
 
-const FglTFRuntimeBlob* FglTFRuntimeParser::GetAdditionalBufferView(const int64 Index, const FString& Name) const
+bool FglTFRuntimeParser::GetAdditionalBufferView(const int64 Index, const FString& Name, FglTFRuntimeBlob& Blob) const
 {
 	if (Index <= INDEX_NONE)
 	{
-		return nullptr;
+		return false;
 	}
 
+	FScopeLock Lock(&AdditionalBufferViewsCacheLock);
+
 	const TMap<FString, FglTFRuntimeBlob>* Value = AdditionalBufferViewsCache.Find(Index);
 	if (!Value)
 	{
-		return nullptr;
+		return false;
 	}
 
-	if (!Value->Contains(Name))
+	const FglTFRuntimeBlob* CachedBlob = Value->Find(Name);
+	if (!CachedBlob)
 	{
-		return nullptr;
+		return false;
 	}
 
-	const FglTFRuntimeBlob& Blob = (*Value)[Name];
+	Blob = *CachedBlob;
 
-	return &Blob;
+	return true;
 }
 
 void FglTFRuntimeParser::AddAdditionalBufferView(const int64 Index, const FString& Name, const FglTFRuntimeBlob& Blob)
@@ -3863,6 +4789,8 @@ void FglTFRuntimeParser::AddAdditionalBufferView(const int64 Index, const FStrin
 		return;
 	}
 
+	FScopeLock Lock(&AdditionalBufferViewsCacheLock);
+
 	if (!AdditionalBufferViewsCache.Contains(Index))
 	{
 		AdditionalBufferViewsCache.Add(Index);
@@ -3993,7 +4921,7 @@ bool FglTFRuntimeParser::GetNumberArrayFromExtras(const FString& Key, TArray<flo
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeExtensionObject(const int32 NodeIndex, const FString& ExtensionName)
 {
-	TSharedPtr<FJsonObject> JsonNodeObject = GetJsonObjectFromRootIndex("nodes", NodeIndex);
+	TSharedPtr<FJsonObject> JsonNodeObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Nodes, NodeIndex);
 	if (!JsonNodeObject)
 	{
 		return nullptr;
@@ -4004,10 +4932,10 @@ TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeExtensionObject(const int32 N
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeObject(const int32 NodeIndex)
 {
-	return GetJsonObjectFromRootIndex("nodes", NodeIndex);
+	return GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Nodes, NodeIndex);
 }
 
-bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes)
+bool FglTFRuntimeParser::DecompressMeshOptimizerReference(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes)
 {
 	auto DecodeZigZag = [](uint8 V)
 	{
@@ -4265,6 +5193,16 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 
 		for (uint32 TriangleIndex = 0; TriangleIndex < TrianglesNum; TriangleIndex++)
 		{
+			// codes can only address the 16 most recent entries
+			if (EdgeFifo.Num() > 16)
+			{
+				EdgeFifo.SetNum(16, false);
+			}
+			if (VertexFifo.Num() > 16)
+			{
+				VertexFifo.SetNum(16, false);
+			}
+
 			if (Offset >= Limit)
 			{
 				return false;
@@ -4514,52 +5452,43 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 		{
 			for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex++)
 			{
-				int64 Offset = ElementIndex * Stride;
+				// 4 components per element
+				int64 Offset = ElementIndex * 4;
 				if (Stride == 4)
 				{
 					int8* Data = reinterpret_cast<int8*>(UncompressedBytes.GetData());
-					float One = Data[Offset + 2];
-					float X = Data[Offset] / One;
-					float Y = Data[Offset + 1] / One;
-					float Z = 1.0f - FMath::Abs(X) - FMath::Abs(Y);
-
-					float T = FMath::Max(-Z, 0.0f);
+					float X = Data[Offset];
+					float Y = Data[Offset + 1];
+					float Z = Data[Offset + 2] - FMath::Abs(X) - FMath::Abs(Y);
 
-					X -= (X >= 0) ? T : -T;
-					Y -= (Y >= 0) ? T : -T;
+					float T = Z >= 0 ? 0.0f : Z;
 
-					float Len = FMath::Sqrt(X * X + Y * Y + Z * Z);
+					X += (X >= 0) ? T : -T;
+					Y += (Y >= 0) ? T : -T;
 
-					X /= Len;
-					Y /= Len;
-					Z /= Len;
+					float Scale = 127.0f / FMath::Sqrt(X * X + Y * Y + Z * Z);
 
-					Data[Offset] = FMath::RoundToInt(X * 127);
-					Data[Offset + 1] = FMath::RoundToInt(Y * 127);
-					Data[Offset + 2] = FMath::RoundToInt(Z * 127);
+					Data[Offset] = static_cast<int32>(X * Scale + (X >= 0 ? 0.5f : -0.5f));
+					Data[Offset + 1] = static_cast<int32>(Y * Scale + (Y >= 0 ? 0.5f : -0.5f));
+					Data[Offset + 2] = static_cast<int32>(Z * Scale + (Z >= 0 ? 0.5f : -0.5f));
 				}
 				else
 				{
 					int16* Data = reinterpret_cast<int16*>(UncompressedBytes.GetData());
-					float One = Data[Offset + 2];
-					float X = Data[Offset] / One;
-					float Y = Data[Offset + 1] / One;
-					float Z = 1.0f - FMath::Abs(X) - FMath::Abs(Y);
-
-					float T = FMath::Max(-Z, 0.0f);
+					float X = Data[Offset];
+					float Y = Data[Offset + 1];
+					float Z = Data[Offset + 2] - FMath::Abs(X) - FMath::Abs(Y);
 
-					X -= (X >= 0) ? T : -T;
-					Y -= (Y >= 0) ? T : -T;
+					float T = Z >= 0 ? 0.0f : Z;
 
-					float Len = FMath::Sqrt(X * X + Y * Y + Z * Z);
+					X += (X >= 0) ? T : -T;
+					Y += (Y >= 0) ? T : -T;
 
-					X /= Len;
-					Y /= Len;
-					Z /= Len;
+					float Scale = 32767.0f / FMath::Sqrt(X * X + Y * Y + Z * Z);
 
-					Data[Offset] = FMath::RoundToInt(X * 32767);
-					Data[Offset + 1] = FMath::RoundToInt(Y * 32767);
-					Data[Offset + 2] = FMath::RoundToInt(Z * 32767);
+					Data[Offset] = static_cast<int32>(X * Scale + (X >= 0 ? 0.5f : -0.5f));
+					Data[Offset + 1] = static_cast<int32>(Y * Scale + (Y >= 0 ? 0.5f : -0.5f));
+					Data[Offset + 2] = static_cast<int32>(Z * Scale + (Z >= 0 ? 0.5f : -0.5f));
 				}
 			}
 		}
@@ -4571,30 +5500,33 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 
 			for (int64 Offset = 0; Offset < Elements * 4; Offset += 4)
 			{
-				float One = Data[Offset + 3] | 3;
+				float Scale = Range / static_cast<float>(Data[Offset + 3] | 3);
 
-				float X = Data[Offset] / One * Range;
-				float Y = Data[Offset + 1] / One * Range;
-				float Z = Data[Offset + 2] / One * Range;
+				float X = Data[Offset] * Scale;
+				float Y = Data[Offset + 1] * Scale;
+				float Z = Data[Offset + 2] * Scale;
 
-				float W = FMath::Sqrt(FMath::Max(0.0, 1.0 - X * X - Y * Y - Z * Z));
+				float WW = 1.0f - X * X - Y * Y - Z * Z;
+				float W = FMath::Sqrt(WW >= 0 ? WW : 0.0f);
 
 				int32 MaxComp = Data[Offset + 3] & 3;
 
-				Data[Offset + ((MaxComp + 1) % 4)] = FMath::RoundToInt(X * 32767.0);
-				Data[Offset + ((MaxComp + 2) % 4)] = FMath::RoundToInt(Y * 32767.0);
-				Data[Offset + ((MaxComp + 3) % 4)] = FMath::RoundToInt(Z * 32767.0);
-				Data[Offset + ((MaxComp + 0) % 4)] = FMath::RoundToInt(W * 32767.0);
+				Data[Offset + ((MaxComp + 1) % 4)] = static_cast<int32>(X * 32767.0f + (X >= 0 ? 0.5f : -0.5f));
+				Data[Offset + ((MaxComp + 2) % 4)] = static_cast<int32>(Y * 32767.0f + (Y >= 0 ? 0.5f : -0.5f));
+				Data[Offset + ((MaxComp + 3) % 4)] = static_cast<int32>(Z * 32767.0f + (Z >= 0 ? 0.5f : -0.5f));
+				Data[Offset + ((MaxComp + 0) % 4)] = static_cast<int32>(W * 32767.0f + 0.5f);
 			}
 		}
 		else if (Filter == "EXPONENTIAL" && (Stride % 4) == 0)
 		{
 			int32* Data = reinterpret_cast<int32*>(UncompressedBytes.GetData());
-			for (int64 Offset = 0; Offset < UncompressedBytes.Num() / 4; Offset += 4)
+			for (int64 Offset = 0; Offset < UncompressedBytes.Num() / 4; Offset++)
 			{
 				int32 E = Data[Offset] >> 24;
-				int32 M = (Data[Offset] << 8) >> 8;
-				Data[Offset] = FMath::Pow(2.0f, E) * M;
+				int32 M = static_cast<int32>(static_cast<uint32>(Data[Offset]) << 8) >> 8;
+				// the float bits are stored
+				float Value = FMath::Pow(2.0f, static_cast<float>(E)) * static_cast<float>(M);
+				FMemory::Memcpy(&Data[Offset], &Value, sizeof(float));
 			}
 		}
 		else if (Filter != "" && Filter != "NONE")
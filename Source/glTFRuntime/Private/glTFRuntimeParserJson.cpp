@@ -0,0 +1,545 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/FileHelper.h"
+
+/*
+* Minimal UTF-8 json reader, builds the FJsonObject DOM directly from the bytes
+* without widening the whole document to TCHAR. Only string tokens are converted.
+*/
+struct FglTFRuntimeUtf8JsonReader
+{
+	const uint8* Cursor;
+	const uint8* End;
+	int32 Depth;
+	FString Error;
+
+	static constexpr int32 MaxDepth = 1024;
+
+	FglTFRuntimeUtf8JsonReader(const uint8* DataPtr, const int64 DataNum) : Cursor(DataPtr), End(DataPtr + DataNum), Depth(0)
+	{
+	}
+
+	FORCEINLINE void SkipWhitespace()
+	{
+		while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t'))
+		{
+			Cursor++;
+		}
+	}
+
+	FORCEINLINE bool Consume(const uint8 Char)
+	{
+		SkipWhitespace();
+		if (Cursor < End && *Cursor == Char)
+		{
+			Cursor++;
+			return true;
+		}
+		return false;
+	}
+
+	bool AppendUtf8(FString& OutString, const uint8* Data, const int64 Num)
+	{
+		if (Num <= 0)
+		{
+			OutString.Empty();
+			return true;
+		}
+
+		// FString is int32 addressed
+		if (Num > MAX_int32)
+		{
+			Error = FString::Printf(TEXT("string token too big (%lld bytes)"), Num);
+			return false;
+		}
+
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), (int32)Num);
+		OutString = FString(Converter.Length(), Converter.Get());
+		return true;
+	}
+
+	static void EncodeUtf8(const uint32 CodePoint, TArray<uint8>& Output)
+	{
+		if (CodePoint < 0x80)
+		{
+			Output.Add((uint8)CodePoint);
+		}
+		else if (CodePoint < 0x800)
+		{
+			Output.Add(0xC0 | (CodePoint >> 6));
+			Output.Add(0x80 | (CodePoint & 0x3F));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Output.Add(0xE0 | (CodePoint >> 12));
+			Output.Add(0x80 | ((CodePoint >> 6) & 0x3F));
+			Output.Add(0x80 | (CodePoint & 0x3F));
+		}
+		else
+		{
+			Output.Add(0xF0 | (CodePoint >> 18));
+			Output.Add(0x80 | ((CodePoint >> 12) & 0x3F));
+			Output.Add(0x80 | ((CodePoint >> 6) & 0x3F));
+			Output.Add(0x80 | (CodePoint & 0x3F));
+		}
+	}
+
+	bool ParseHex4(uint32& CodePoint)
+	{
+		if (End - Cursor < 4)
+		{
+			return false;
+		}
+
+		CodePoint = 0;
+		for (int32 i = 0; i < 4; i++)
+		{
+			const uint8 Char = *Cursor++;
+			CodePoint <<= 4;
+			if (Char >= '0' && Char <= '9')
+			{
+				CodePoint |= Char - '0';
+			}
+			else if (Char >= 'a' && Char <= 'f')
+			{
+				CodePoint |= Char - 'a' + 10;
+			}
+			else if (Char >= 'A' && Char <= 'F')
+			{
+				CodePoint |= Char - 'A' + 10;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool ParseString(FString& OutString)
+	{
+		if (!Consume('"'))
+		{
+			return false;
+		}
+
+		// fast path: no escapes, convert the span directly
+		const uint8* Start = Cursor;
+		while (Cursor < End && *Cursor != '"' && *Cursor != '\\' && *Cursor >= 0x20)
+		{
+			Cursor++;
+		}
+
+		if (Cursor >= End)
+		{
+			return false;
+		}
+
+		// control characters must be escaped (TJsonReader rejects them too)
+		if (*Cursor < 0x20)
+		{
+			Error = TEXT("unescaped control character in string");
+			return false;
+		}
+
+		if (*Cursor == '"')
+		{
+			const int64 Len = Cursor - Start;
+			Cursor++;
+			return AppendUtf8(OutString, Start, Len);
+		}
+
+		TArray<uint8> Decoded;
+		Decoded.Append(Start, Cursor - Start);
+
+		while (Cursor < End)
+		{
+			const uint8 Char = *Cursor++;
+			if (Char == '"')
+			{
+				return AppendUtf8(OutString, Decoded.GetData(), Decoded.Num());
+			}
+
+			if (Char < 0x20)
+			{
+				Cursor--;
+				Error = TEXT("unescaped control character in string");
+				return false;
+			}
+
+			if (Char != '\\')
+			{
+				Decoded.Add(Char);
+				continue;
+			}
+
+			if (Cursor >= End)
+			{
+				return false;
+			}
+
+			const uint8 Escape = *Cursor++;
+			switch (Escape)
+			{
+			case '"':
+			case '\\':
+			case '/':
+				Decoded.Add(Escape);
+				break;
+			case 'b':
+				Decoded.Add('\b');
+				break;
+			case 'f':
+				Decoded.Add('\f');
+				break;
+			case 'n':
+				Decoded.Add('\n');
+				break;
+			case 'r':
+				Decoded.Add('\r');
+				break;
+			case 't':
+				Decoded.Add('\t');
+				break;
+			case 'u':
+			{
+				uint32 CodePoint = 0;
+				if (!ParseHex4(CodePoint))
+				{
+					return false;
+				}
+				// surrogate pair
+				if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+				{
+					uint32 LowSurrogate = 0;
+					if (End - Cursor < 6 || Cursor[0] != '\\' || Cursor[1] != 'u')
+					{
+						return false;
+					}
+					Cursor += 2;
+					if (!ParseHex4(LowSurrogate) || LowSurrogate < 0xDC00 || LowSurrogate > 0xDFFF)
+					{
+						return false;
+					}
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				}
+				EncodeUtf8(CodePoint, Decoded);
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+	FORCEINLINE bool IsDigit() const
+	{
+		return Cursor < End && *Cursor >= '0' && *Cursor <= '9';
+	}
+
+	FORCEINLINE void SkipDigits()
+	{
+		while (IsDigit())
+		{
+			Cursor++;
+		}
+	}
+
+	// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+	bool ParseNumber(double& OutNumber)
+	{
+		const uint8* Start = Cursor;
+		if (Cursor < End && *Cursor == '-')
+		{
+			Cursor++;
+		}
+
+		if (!IsDigit())
+		{
+			return false;
+		}
+
+		if (*Cursor++ != '0')
+		{
+			SkipDigits();
+		}
+		else if (IsDigit())
+		{
+			// leading zeros are not allowed
+			return false;
+		}
+
+		if (Cursor < End && *Cursor == '.')
+		{
+			Cursor++;
+			if (!IsDigit())
+			{
+				return false;
+			}
+			SkipDigits();
+		}
+
+		if (Cursor < End && (*Cursor == 'e' || *Cursor == 'E'))
+		{
+			Cursor++;
+			if (Cursor < End && (*Cursor == '+' || *Cursor == '-'))
+			{
+				Cursor++;
+			}
+			if (!IsDigit())
+			{
+				return false;
+			}
+			SkipDigits();
+		}
+
+		const int64 Len = Cursor - Start;
+
+		ANSICHAR NumberBuffer[64];
+		if (Len < 64)
+		{
+			FMemory::Memcpy(NumberBuffer, Start, Len);
+			NumberBuffer[Len] = 0;
+			OutNumber = FCStringAnsi::Atod(NumberBuffer);
+			return true;
+		}
+
+		TArray<ANSICHAR> LongNumberBuffer;
+		LongNumberBuffer.Append(reinterpret_cast<const ANSICHAR*>(Start), Len);
+		LongNumberBuffer.Add(0);
+		OutNumber = FCStringAnsi::Atod(LongNumberBuffer.GetData());
+		return true;
+	}
+
+	bool ParseLiteral(const char* Literal, const int32 LiteralLen)
+	{
+		if (End - Cursor < LiteralLen || FMemory::Memcmp(Cursor, Literal, LiteralLen) != 0)
+		{
+			return false;
+		}
+		Cursor += LiteralLen;
+		return true;
+	}
+
+	bool ParseObject(TSharedPtr<FJsonObject>& OutObject)
+	{
+		if (!Consume('{'))
+		{
+			return false;
+		}
+
+		OutObject = MakeShared<FJsonObject>();
+
+		if (Consume('}'))
+		{
+			return true;
+		}
+
+		for (;;)
+		{
+			FString Key;
+			if (!ParseString(Key))
+			{
+				return false;
+			}
+
+			if (!Consume(':'))
+			{
+				return false;
+			}
+
+			TSharedPtr<FJsonValue> Value;
+			if (!ParseValue(Value))
+			{
+				return false;
+			}
+
+			OutObject->Values.Add(MoveTemp(Key), Value);
+
+			if (Consume(','))
+			{
+				continue;
+			}
+
+			return Consume('}');
+		}
+	}
+
+	bool ParseArray(TArray<TSharedPtr<FJsonValue>>& OutArray)
+	{
+		if (!Consume('['))
+		{
+			return false;
+		}
+
+		if (Consume(']'))
+		{
+			return true;
+		}
+
+		for (;;)
+		{
+			TSharedPtr<FJsonValue> Value;
+			if (!ParseValue(Value))
+			{
+				return false;
+			}
+
+			OutArray.Add(Value);
+
+			if (Consume(','))
+			{
+				continue;
+			}
+
+			return Consume(']');
+		}
+	}
+
+	bool ParseValue(TSharedPtr<FJsonValue>& OutValue)
+	{
+		SkipWhitespace();
+		if (Cursor >= End)
+		{
+			return false;
+		}
+
+		if (++Depth > MaxDepth)
+		{
+			return false;
+		}
+
+		bool bSuccess = false;
+
+		switch (*Cursor)
+		{
+		case '{':
+		{
+			TSharedPtr<FJsonObject> Object;
+			bSuccess = ParseObject(Object);
+			if (bSuccess)
+			{
+				OutValue = MakeShared<FJsonValueObject>(Object);
+			}
+			break;
+		}
+		case '[':
+		{
+			TArray<TSharedPtr<FJsonValue>> Array;
+			bSuccess = ParseArray(Array);
+			if (bSuccess)
+			{
+				OutValue = MakeShared<FJsonValueArray>(Array);
+			}
+			break;
+		}
+		case '"':
+		{
+			FString String;
+			bSuccess = ParseString(String);
+			if (bSuccess)
+			{
+				OutValue = MakeShared<FJsonValueString>(String);
+			}
+			break;
+		}
+		case 't':
+			bSuccess = ParseLiteral("true", 4);
+			if (bSuccess)
+			{
+				OutValue = MakeShared<FJsonValueBoolean>(true);
+			}
+			break;
+		case 'f':
+			bSuccess = ParseLiteral("false", 5);
+			if (bSuccess)
+			{
+				OutValue = MakeShared<FJsonValueBoolean>(false);
+			}
+			break;
+		case 'n':
+			bSuccess = ParseLiteral("null", 4);
+			if (bSuccess)
+			{
+				OutValue = MakeShared<FJsonValueNull>();
+			}
+			break;
+		default:
+		{
+			double Number = 0;
+			bSuccess = ParseNumber(Number);
+			if (bSuccess)
+			{
+				OutValue = MakeShared<FJsonValueNumber>(Number);
+			}
+			break;
+		}
+		}
+
+		Depth--;
+		return bSuccess;
+	}
+};
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::ParseJsonBytes(const uint8* DataPtr, int64 DataNum)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_ParseJsonBytes, FColor::Magenta);
+
+	// skip UTF-8 BOM
+	if (DataNum >= 3 && DataPtr[0] == 0xEF && DataPtr[1] == 0xBB && DataPtr[2] == 0xBF)
+	{
+		DataPtr += 3;
+		DataNum -= 3;
+	}
+
+	FglTFRuntimeUtf8JsonReader Reader(DataPtr, DataNum);
+
+	TSharedPtr<FJsonObject> JsonObject;
+	bool bSuccess = Reader.ParseObject(JsonObject);
+	if (bSuccess)
+	{
+		// only whitespace is allowed after the root value
+		Reader.SkipWhitespace();
+		if (Reader.Cursor < Reader.End)
+		{
+			Reader.Error = TEXT("unexpected content after the root object");
+			bSuccess = false;
+		}
+	}
+
+	if (!bSuccess)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid json at offset %lld%s%s"), (int64)(Reader.Cursor - DataPtr), Reader.Error.IsEmpty() ? TEXT("") : TEXT(": "), *Reader.Error);
+		return nullptr;
+	}
+
+	return JsonObject;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonBytes(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromJsonBytes, FColor::Magenta);
+
+	// UTF-16 content, use the standard TCHAR path
+	if (DataNum >= 2 && ((DataPtr[0] == 0xFF && DataPtr[1] == 0xFE) || (DataPtr[0] == 0xFE && DataPtr[1] == 0xFF)))
+	{
+		if (DataNum > INT32_MAX)
+		{
+			return nullptr;
+		}
+		FString JsonData;
+		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
+		return FromString(JsonData, LoaderConfig, InZipFile);
+	}
+
+	TSharedPtr<FJsonObject> JsonObject = ParseJsonBytes(DataPtr, DataNum);
+	if (!JsonObject)
+	{
+		return nullptr;
+	}
+
+	return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InZipFile);
+}
@@ -1,6 +1,7 @@
 // Copyright 2020-2023, Roberto De Ioris.
 
 #include "glTFRuntimeParser.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Texture2D.h"
 #include "IImageWrapperModule.h"
@@ -264,7 +265,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 
 	UMaterialInterface* Material = nullptr;
 
-	FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this, Index, MaterialName, &Material, &RuntimeMaterial, MaterialsConfig, bUseVertexColors]()
+	FglTFRuntimeGameThreadQueue::Get().EnqueueAndWait([this, Index, MaterialName, &Material, &RuntimeMaterial, MaterialsConfig, bUseVertexColors]()
 		{
 			// this is mainly for editor ...
 			if (IsGarbageCollecting())
@@ -272,8 +273,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 				return;
 			}
 	Material = BuildMaterial(Index, MaterialName, RuntimeMaterial, MaterialsConfig, bUseVertexColors);
-		}, TStatId(), nullptr, ENamedThreads::GameThread);
-	FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+		});
 
 	return Material;
 }
@@ -347,7 +347,10 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 
 	Texture->UpdateResource();
 
-	TexturesCache.Add(Mips[0].TextureIndex, Texture);
+	{
+		FScopeLock Lock(&TexturesCacheLock);
+		TexturesCache.Add(Mips[0].TextureIndex, Texture);
+	}
 
 	return Texture;
 }
@@ -629,7 +632,7 @@ bool FglTFRuntimeParser::LoadImageFromBlob(TArray64<uint8>& Blob, TSharedRef<FJs
 bool FglTFRuntimeParser::LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJsonObject>& JsonImageObject, TArray64<uint8>& Bytes)
 {
 
-	JsonImageObject = GetJsonObjectFromRootIndex("images", ImageIndex);
+	JsonImageObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Images, ImageIndex);
 	if (!JsonImageObject)
 	{
 		AddError("LoadImageBytes()", FString::Printf(TEXT("Unable to load image %d"), ImageIndex));
@@ -673,9 +676,12 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 	}
 
 	// first check cache
-	if (TexturesCache.Contains(TextureIndex))
 	{
-		return TexturesCache[TextureIndex];
+		FScopeLock Lock(&TexturesCacheLock);
+		if (UTexture2D** CachedTexture = TexturesCache.Find(TextureIndex))
+		{
+			return *CachedTexture;
+		}
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
@@ -895,13 +901,17 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 	}
 
 	// first check cache
-	if (CanReadFromCache(MaterialsConfig.CacheMode) && MaterialsCache.Contains(Index))
+	if (CanReadFromCache(MaterialsConfig.CacheMode))
 	{
-		if (MaterialsNameCache.Contains(MaterialsCache[Index]))
+		FScopeLock Lock(&MaterialsCacheLock);
+		if (UMaterialInterface** CachedMaterial = MaterialsCache.Find(Index))
 		{
-			MaterialName = MaterialsNameCache[MaterialsCache[Index]];
+			if (const FString* CachedMaterialName = MaterialsNameCache.Find(*CachedMaterial))
+			{
+				MaterialName = *CachedMaterialName;
+			}
+			return *CachedMaterial;
 		}
-		return MaterialsCache[Index];
 	}
 
 	const TArray<TSharedPtr<FJsonValue>>* JsonMaterials;
@@ -943,6 +953,16 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 
 	if (CanWriteToCache(MaterialsConfig.CacheMode))
 	{
+		// materials are built outside of the lock, the first one completing wins
+		FScopeLock Lock(&MaterialsCacheLock);
+		if (UMaterialInterface** CachedMaterial = MaterialsCache.Find(Index))
+		{
+			if (const FString* CachedMaterialName = MaterialsNameCache.Find(*CachedMaterial))
+			{
+				MaterialName = *CachedMaterialName;
+			}
+			return *CachedMaterial;
+		}
 		MaterialsNameCache.Add(Material, MaterialName);
 		MaterialsCache.Add(Index, Material);
 	}
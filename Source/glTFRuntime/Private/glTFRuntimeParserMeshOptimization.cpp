@@ -0,0 +1,350 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+
+/*
+* Post-transform vertex cache, overdraw and vertex fetch optimizations.
+* The algorithms follow the meshoptimizer ones (Forsyth-like scoring for the vertex cache,
+* clusters sorting for the overdraw and first-use reordering for the vertex fetch).
+* Indices are always relative to a [0, NumVertices) range.
+*/
+
+static constexpr int32 glTFRuntimeScoringCacheSize = 16;
+
+static float glTFRuntimeVertexScore(const int32 CachePosition, const int32 LiveTriangles)
+{
+	// no more triangles will use this vertex
+	if (LiveTriangles == 0)
+	{
+		return -1;
+	}
+
+	float Score = 0;
+	if (CachePosition >= 0)
+	{
+		// the last triangle vertices get a fixed score to avoid favoring strips
+		if (CachePosition < 3)
+		{
+			Score = 0.75f;
+		}
+		else
+		{
+			Score = FMath::Pow(1.0f - (CachePosition - 3) / static_cast<float>(glTFRuntimeScoringCacheSize - 3), 1.5f);
+		}
+	}
+
+	// low valence vertices are preferred (they close the holes)
+	return Score + 2.0f * FMath::InvSqrt(static_cast<float>(LiveTriangles));
+}
+
+void FglTFRuntimeParser::OptimizeVertexCache(TArray<uint32>& Indices, const int32 NumVertices)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_OptimizeVertexCache, FColor::Magenta);
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles < 2 || NumVertices <= 0)
+	{
+		return;
+	}
+
+	// vertex -> triangles adjacency
+	TArray<int32> LiveTriangles;
+	LiveTriangles.AddZeroed(NumVertices);
+	for (int32 Index = 0; Index < NumTriangles * 3; Index++)
+	{
+		LiveTriangles[Indices[Index]]++;
+	}
+
+	TArray<int32> AdjacencyOffsets;
+	AdjacencyOffsets.AddUninitialized(NumVertices);
+	int32 Offset = 0;
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		AdjacencyOffsets[VertexIndex] = Offset;
+		Offset += LiveTriangles[VertexIndex];
+	}
+
+	TArray<int32> AdjacencyTriangles;
+	AdjacencyTriangles.AddUninitialized(Offset);
+	{
+		TArray<int32> AdjacencyCounts;
+		AdjacencyCounts.AddZeroed(NumVertices);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + Corner];
+				AdjacencyTriangles[AdjacencyOffsets[VertexIndex] + AdjacencyCounts[VertexIndex]++] = TriangleIndex;
+			}
+		}
+	}
+
+	TArray<float> VertexScores;
+	VertexScores.AddUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		VertexScores[VertexIndex] = glTFRuntimeVertexScore(INDEX_NONE, LiveTriangles[VertexIndex]);
+	}
+
+	TArray<float> TriangleScores;
+	TriangleScores.AddUninitialized(NumTriangles);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		TriangleScores[TriangleIndex] = VertexScores[Indices[TriangleIndex * 3]] + VertexScores[Indices[TriangleIndex * 3 + 1]] + VertexScores[Indices[TriangleIndex * 3 + 2]];
+	}
+
+	TArray<bool> EmittedTriangles;
+	EmittedTriangles.AddZeroed(NumTriangles);
+
+	TArray<uint32> Cache;
+	Cache.Reserve(glTFRuntimeScoringCacheSize + 3);
+	TArray<uint32> NewCache;
+	NewCache.Reserve(glTFRuntimeScoringCacheSize + 3);
+
+	TArray<uint32> OptimizedIndices;
+	OptimizedIndices.Reserve(Indices.Num());
+
+	int32 InputCursor = 0;
+	int32 BestTriangle = 0;
+	for (int32 TriangleIndex = 1; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		if (TriangleScores[TriangleIndex] > TriangleScores[BestTriangle])
+		{
+			BestTriangle = TriangleIndex;
+		}
+	}
+
+	while (BestTriangle != INDEX_NONE)
+	{
+		const uint32 A = Indices[BestTriangle * 3];
+		const uint32 B = Indices[BestTriangle * 3 + 1];
+		const uint32 C = Indices[BestTriangle * 3 + 2];
+
+		OptimizedIndices.Add(A);
+		OptimizedIndices.Add(B);
+		OptimizedIndices.Add(C);
+		EmittedTriangles[BestTriangle] = true;
+
+		// remove the triangle from the adjacency
+		for (const uint32 VertexIndex : { A, B, C })
+		{
+			int32* Triangles = AdjacencyTriangles.GetData() + AdjacencyOffsets[VertexIndex];
+			const int32 NumLiveTriangles = LiveTriangles[VertexIndex];
+			for (int32 AdjacencyIndex = 0; AdjacencyIndex < NumLiveTriangles; AdjacencyIndex++)
+			{
+				if (Triangles[AdjacencyIndex] == BestTriangle)
+				{
+					Triangles[AdjacencyIndex] = Triangles[NumLiveTriangles - 1];
+					LiveTriangles[VertexIndex]--;
+					break;
+				}
+			}
+		}
+
+		// the emitted vertices move to the front of the cache
+		NewCache.Reset();
+		NewCache.AddUnique(A);
+		NewCache.AddUnique(B);
+		NewCache.AddUnique(C);
+		for (const uint32 VertexIndex : Cache)
+		{
+			if (VertexIndex != A && VertexIndex != B && VertexIndex != C)
+			{
+				NewCache.Add(VertexIndex);
+			}
+		}
+		Swap(Cache, NewCache);
+
+		// vertices falling out of the cache
+		for (int32 CacheIndex = glTFRuntimeScoringCacheSize; CacheIndex < Cache.Num(); CacheIndex++)
+		{
+			const uint32 VertexIndex = Cache[CacheIndex];
+			const float NewScore = glTFRuntimeVertexScore(INDEX_NONE, LiveTriangles[VertexIndex]);
+			const float DeltaScore = NewScore - VertexScores[VertexIndex];
+			VertexScores[VertexIndex] = NewScore;
+			for (int32 AdjacencyIndex = 0; AdjacencyIndex < LiveTriangles[VertexIndex]; AdjacencyIndex++)
+			{
+				TriangleScores[AdjacencyTriangles[AdjacencyOffsets[VertexIndex] + AdjacencyIndex]] += DeltaScore;
+			}
+		}
+		if (Cache.Num() > glTFRuntimeScoringCacheSize)
+		{
+			Cache.SetNum(glTFRuntimeScoringCacheSize, false);
+		}
+
+		// update the scores of the cached vertices and find the next best triangle among their triangles
+		BestTriangle = INDEX_NONE;
+		float BestScore = -1;
+		for (int32 CacheIndex = 0; CacheIndex < Cache.Num(); CacheIndex++)
+		{
+			const uint32 VertexIndex = Cache[CacheIndex];
+
+			const float NewScore = glTFRuntimeVertexScore(CacheIndex, LiveTriangles[VertexIndex]);
+			const float DeltaScore = NewScore - VertexScores[VertexIndex];
+			VertexScores[VertexIndex] = NewScore;
+
+			for (int32 AdjacencyIndex = 0; AdjacencyIndex < LiveTriangles[VertexIndex]; AdjacencyIndex++)
+			{
+				const int32 TriangleIndex = AdjacencyTriangles[AdjacencyOffsets[VertexIndex] + AdjacencyIndex];
+				TriangleScores[TriangleIndex] += DeltaScore;
+				if (TriangleScores[TriangleIndex] > BestScore)
+				{
+					BestScore = TriangleScores[TriangleIndex];
+					BestTriangle = TriangleIndex;
+				}
+			}
+		}
+
+		// dead end, continue with the next triangle in input order
+		if (BestTriangle == INDEX_NONE)
+		{
+			while (InputCursor < NumTriangles && EmittedTriangles[InputCursor])
+			{
+				InputCursor++;
+			}
+			if (InputCursor < NumTriangles)
+			{
+				BestTriangle = InputCursor;
+			}
+		}
+	}
+
+	// non-triangles leftovers are preserved
+	for (int32 Index = NumTriangles * 3; Index < Indices.Num(); Index++)
+	{
+		OptimizedIndices.Add(Indices[Index]);
+	}
+
+	Indices = MoveTemp(OptimizedIndices);
+}
+
+void FglTFRuntimeParser::OptimizeOverdraw(TArray<uint32>& Indices, const TArray<FVector>& Positions)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_OptimizeOverdraw, FColor::Magenta);
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles < 2)
+	{
+		return;
+	}
+
+	// clusters start where the cache is fully missed (the vertex cache optimizer jumped to a new patch)
+	TArray<int32> ClustersStart;
+	{
+		TArray<uint32> CacheTimestamps;
+		CacheTimestamps.AddZeroed(Positions.Num());
+		uint32 Timestamp = glTFRuntimeScoringCacheSize + 1;
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			int32 Misses = 0;
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + Corner];
+				if (Timestamp - CacheTimestamps[VertexIndex] > glTFRuntimeScoringCacheSize)
+				{
+					CacheTimestamps[VertexIndex] = Timestamp++;
+					Misses++;
+				}
+			}
+
+			if (TriangleIndex == 0 || Misses == 3)
+			{
+				ClustersStart.Add(TriangleIndex);
+			}
+		}
+	}
+
+	if (ClustersStart.Num() < 2)
+	{
+		return;
+	}
+
+	FVector MeshCentroid = FVector::ZeroVector;
+	for (int32 Index = 0; Index < NumTriangles * 3; Index++)
+	{
+		MeshCentroid += Positions[Indices[Index]];
+	}
+	MeshCentroid /= NumTriangles * 3;
+
+	// clusters facing outside (and far from the center) are drawn first
+	TArray<TPair<float, int32>> ClustersSortKeys;
+	ClustersSortKeys.AddUninitialized(ClustersStart.Num());
+	for (int32 ClusterIndex = 0; ClusterIndex < ClustersStart.Num(); ClusterIndex++)
+	{
+		const int32 ClusterEnd = ClusterIndex + 1 < ClustersStart.Num() ? ClustersStart[ClusterIndex + 1] : NumTriangles;
+
+		FVector ClusterCentroid = FVector::ZeroVector;
+		FVector ClusterNormal = FVector::ZeroVector;
+		float ClusterArea = 0;
+		for (int32 TriangleIndex = ClustersStart[ClusterIndex]; TriangleIndex < ClusterEnd; TriangleIndex++)
+		{
+			const FVector& Position0 = Positions[Indices[TriangleIndex * 3]];
+			const FVector& Position1 = Positions[Indices[TriangleIndex * 3 + 1]];
+			const FVector& Position2 = Positions[Indices[TriangleIndex * 3 + 2]];
+
+			const FVector Normal = FVector::CrossProduct(Position1 - Position0, Position2 - Position0);
+			const float Area = Normal.Size();
+
+			ClusterCentroid += (Position0 + Position1 + Position2) * (Area / 3);
+			ClusterNormal += Normal;
+			ClusterArea += Area;
+		}
+
+		ClusterCentroid = ClusterArea > 0 ? ClusterCentroid / ClusterArea : MeshCentroid;
+		ClustersSortKeys[ClusterIndex] = TPair<float, int32>(FVector::DotProduct(ClusterCentroid - MeshCentroid, ClusterNormal.GetSafeNormal()), ClusterIndex);
+	}
+
+	ClustersSortKeys.StableSort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key > B.Key; });
+
+	TArray<uint32> OptimizedIndices;
+	OptimizedIndices.Reserve(Indices.Num());
+	for (const TPair<float, int32>& Pair : ClustersSortKeys)
+	{
+		const int32 ClusterEnd = Pair.Value + 1 < ClustersStart.Num() ? ClustersStart[Pair.Value + 1] : NumTriangles;
+		OptimizedIndices.Append(Indices.GetData() + ClustersStart[Pair.Value] * 3, (ClusterEnd - ClustersStart[Pair.Value]) * 3);
+	}
+
+	for (int32 Index = NumTriangles * 3; Index < Indices.Num(); Index++)
+	{
+		OptimizedIndices.Add(Indices[Index]);
+	}
+
+	Indices = MoveTemp(OptimizedIndices);
+}
+
+int32 FglTFRuntimeParser::OptimizeVertexFetchRemap(TArray<uint32>& Indices, const int32 NumVertices, TArray<int32>& Remap)
+{
+	Remap.Init(INDEX_NONE, NumVertices);
+
+	int32 NextVertex = 0;
+	for (uint32& VertexIndex : Indices)
+	{
+		if (Remap[VertexIndex] == INDEX_NONE)
+		{
+			Remap[VertexIndex] = NextVertex++;
+		}
+		VertexIndex = Remap[VertexIndex];
+	}
+
+	return NextVertex;
+}
+
+int64 FglTFRuntimeParser::CountVertexCacheMisses(const TArray<uint32>& Indices, const int32 NumVertices, const int32 CacheSize)
+{
+	// FIFO cache simulation
+	TArray<uint32> CacheTimestamps;
+	CacheTimestamps.AddZeroed(NumVertices);
+	uint32 Timestamp = CacheSize + 1;
+	int64 Misses = 0;
+
+	for (const uint32 VertexIndex : Indices)
+	{
+		if (Timestamp - CacheTimestamps[VertexIndex] > static_cast<uint32>(CacheSize))
+		{
+			CacheTimestamps[VertexIndex] = Timestamp++;
+			Misses++;
+		}
+	}
+
+	return Misses;
+}
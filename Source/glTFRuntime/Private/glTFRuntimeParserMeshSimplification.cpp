@@ -0,0 +1,468 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Async/ParallelFor.h"
+
+/*
+* Runtime LODs generation.
+* Edge collapse simplification driven by quadric error metrics (Garland-Heckbert).
+* The collapsed vertex is always moved over the surviving one, so no new vertices are
+* generated and the LOD0 vertex buffers can be reused as-is (only the indices change).
+* Border, seam (same position, different attributes) and non-manifold vertices are locked.
+* Errors are relative to the mesh extent.
+*/
+
+struct FglTFRuntimeSimplifierQuadric
+{
+	double A00 = 0, A01 = 0, A02 = 0, A11 = 0, A12 = 0, A22 = 0;
+	double B0 = 0, B1 = 0, B2 = 0;
+	double C = 0;
+	double W = 0;
+
+	void AddPlane(const FVector& Normal, const double Distance, const double Weight)
+	{
+		A00 += Weight * Normal.X * Normal.X;
+		A01 += Weight * Normal.X * Normal.Y;
+		A02 += Weight * Normal.X * Normal.Z;
+		A11 += Weight * Normal.Y * Normal.Y;
+		A12 += Weight * Normal.Y * Normal.Z;
+		A22 += Weight * Normal.Z * Normal.Z;
+		B0 += Weight * Normal.X * Distance;
+		B1 += Weight * Normal.Y * Distance;
+		B2 += Weight * Normal.Z * Distance;
+		C += Weight * Distance * Distance;
+		W += Weight;
+	}
+
+	void Add(const FglTFRuntimeSimplifierQuadric& Other)
+	{
+		A00 += Other.A00;
+		A01 += Other.A01;
+		A02 += Other.A02;
+		A11 += Other.A11;
+		A12 += Other.A12;
+		A22 += Other.A22;
+		B0 += Other.B0;
+		B1 += Other.B1;
+		B2 += Other.B2;
+		C += Other.C;
+		W += Other.W;
+	}
+
+	// (area weighted) squared distance from the planes
+	double Error(const FVector& Position) const
+	{
+		const double X = Position.X;
+		const double Y = Position.Y;
+		const double Z = Position.Z;
+
+		const double Value = A00 * X * X + A11 * Y * Y + A22 * Z * Z +
+			2 * (A01 * X * Y + A02 * X * Z + A12 * Y * Z) +
+			2 * (B0 * X + B1 * Y + B2 * Z) + C;
+
+		return W > 0 ? FMath::Abs(Value) / W : 0;
+	}
+};
+
+struct FglTFRuntimeSimplifierCollapse
+{
+	int32 From;
+	int32 To;
+	uint32 ToWedge;
+	double Error;
+};
+
+float FglTFRuntimeParser::SimplifyIndices(TArray<uint32>& Indices, const TArray<FVector>& Positions, const TArray<FVector>& Normals, const TArray<FVector2D>& UVs, const int32 TargetNumTriangles, const float MaxError, const float AttributesWeight)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_SimplifyIndices, FColor::Magenta);
+
+	const int32 NumVertices = Positions.Num();
+	if (Indices.Num() % 3 != 0 || Indices.Num() / 3 <= TargetNumTriangles || NumVertices < 3)
+	{
+		return 0;
+	}
+
+	TArray<bool> bReferenced;
+	bReferenced.AddZeroed(NumVertices);
+	for (const uint32 Index : Indices)
+	{
+		if (Index >= static_cast<uint32>(NumVertices))
+		{
+			return 0;
+		}
+		bReferenced[Index] = true;
+	}
+
+	const FBox Box(Positions);
+	const double Extent = Box.GetSize().GetMax();
+	if (Extent <= 0)
+	{
+		return 0;
+	}
+
+	TArray<FVector> ScaledPositions;
+	ScaledPositions.AddUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		ScaledPositions[VertexIndex] = (Positions[VertexIndex] - Box.Min) / Extent;
+	}
+
+	// weld wedges by position, the first wedge is the topological vertex
+	TArray<int32> Welded;
+	Welded.AddUninitialized(NumVertices);
+	TArray<int32> NumWedges;
+	NumWedges.AddZeroed(NumVertices);
+	{
+		TMap<FVector, int32> PositionsMap;
+		PositionsMap.Reserve(NumVertices);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			Welded[VertexIndex] = VertexIndex;
+			if (!bReferenced[VertexIndex])
+			{
+				continue;
+			}
+
+			if (const int32* FirstWedge = PositionsMap.Find(Positions[VertexIndex]))
+			{
+				Welded[VertexIndex] = *FirstWedge;
+			}
+			else
+			{
+				PositionsMap.Add(Positions[VertexIndex], VertexIndex);
+			}
+			NumWedges[Welded[VertexIndex]]++;
+		}
+	}
+
+	TArray<bool> bLocked;
+	bLocked.AddZeroed(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		if (NumWedges[VertexIndex] > 1)
+		{
+			bLocked[VertexIndex] = true;
+		}
+	}
+
+	const int32 NumSourceTriangles = Indices.Num() / 3;
+
+	{
+		TMap<uint64, int32> EdgesCount;
+		EdgesCount.Reserve(NumSourceTriangles * 2);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumSourceTriangles; TriangleIndex++)
+		{
+			for (int32 Edge = 0; Edge < 3; Edge++)
+			{
+				const int32 A = Welded[Indices[TriangleIndex * 3 + Edge]];
+				const int32 B = Welded[Indices[TriangleIndex * 3 + (Edge + 1) % 3]];
+				if (A != B)
+				{
+					EdgesCount.FindOrAdd((static_cast<uint64>(FMath::Min(A, B)) << 32) | FMath::Max(A, B))++;
+				}
+			}
+		}
+
+		// borders and non-manifold edges
+		for (const TPair<uint64, int32>& Pair : EdgesCount)
+		{
+			if (Pair.Value != 2)
+			{
+				bLocked[static_cast<int32>(Pair.Key >> 32)] = true;
+				bLocked[static_cast<int32>(Pair.Key & 0xFFFFFFFF)] = true;
+			}
+		}
+	}
+
+	TArray<FglTFRuntimeSimplifierQuadric> Quadrics;
+	Quadrics.AddDefaulted(NumVertices);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumSourceTriangles; TriangleIndex++)
+	{
+		const int32 V0 = Welded[Indices[TriangleIndex * 3]];
+		const int32 V1 = Welded[Indices[TriangleIndex * 3 + 1]];
+		const int32 V2 = Welded[Indices[TriangleIndex * 3 + 2]];
+
+		FVector Normal = FVector::CrossProduct(ScaledPositions[V1] - ScaledPositions[V0], ScaledPositions[V2] - ScaledPositions[V0]);
+		const double DoubleArea = Normal.Size();
+		if (DoubleArea <= 0)
+		{
+			continue;
+		}
+		Normal /= DoubleArea;
+
+		const double Distance = -FVector::DotProduct(Normal, ScaledPositions[V0]);
+		Quadrics[V0].AddPlane(Normal, Distance, DoubleArea * 0.5);
+		Quadrics[V1].AddPlane(Normal, Distance, DoubleArea * 0.5);
+		Quadrics[V2].AddPlane(Normal, Distance, DoubleArea * 0.5);
+	}
+
+	const bool bHasNormals = Normals.Num() == NumVertices;
+	const bool bHasUVs = UVs.Num() == NumVertices;
+	const double MaxErrorSquared = static_cast<double>(MaxError) * MaxError;
+	const double AttributesWeightSquared = static_cast<double>(AttributesWeight) * AttributesWeight;
+	const int32 TargetTriangles = FMath::Max(TargetNumTriangles, 0);
+
+	TArray<uint32> CollapseTarget;
+	CollapseTarget.AddUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		CollapseTarget[VertexIndex] = VertexIndex;
+	}
+
+	TArray<uint32> CurrentIndices = Indices;
+	TArray<uint32> NextIndices;
+	TArray<FglTFRuntimeSimplifierCollapse> Collapses;
+	TArray<int32> AdjacencyOffsets;
+	TArray<int32> Adjacency;
+	TArray<bool> bTouched;
+	double ResultError = 0;
+
+	// each pass applies the cheapest non-overlapping collapses
+	while (CurrentIndices.Num() / 3 > TargetTriangles)
+	{
+		const int32 NumTriangles = CurrentIndices.Num() / 3;
+
+		// every directed edge From->To is a candidate (the opposite one comes from the adjacent triangle)
+		Collapses.Reset();
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			for (int32 Edge = 0; Edge < 3; Edge++)
+			{
+				const uint32 FromWedge = CurrentIndices[TriangleIndex * 3 + Edge];
+				const uint32 ToWedge = CurrentIndices[TriangleIndex * 3 + (Edge + 1) % 3];
+				const int32 From = Welded[FromWedge];
+				const int32 To = Welded[ToWedge];
+				if (From == To || bLocked[From])
+				{
+					continue;
+				}
+
+				double Error = Quadrics[From].Error(ScaledPositions[To]);
+				if (AttributesWeightSquared > 0)
+				{
+					double AttributesDistance = 0;
+					if (bHasNormals)
+					{
+						AttributesDistance += FVector::DistSquared(Normals[FromWedge], Normals[ToWedge]);
+					}
+					if (bHasUVs)
+					{
+						AttributesDistance += FVector2D::DistSquared(UVs[FromWedge], UVs[ToWedge]);
+					}
+					Error += AttributesWeightSquared * AttributesDistance;
+				}
+
+				if (Error <= MaxErrorSquared)
+				{
+					Collapses.Add({ From, To, ToWedge, Error });
+				}
+			}
+		}
+
+		if (Collapses.Num() == 0)
+		{
+			break;
+		}
+
+		Collapses.Sort([](const FglTFRuntimeSimplifierCollapse& A, const FglTFRuntimeSimplifierCollapse& B) { return A.Error < B.Error; });
+
+		// vertex -> triangles adjacency
+		AdjacencyOffsets.Reset();
+		AdjacencyOffsets.AddZeroed(NumVertices + 1);
+		for (const uint32 Index : CurrentIndices)
+		{
+			AdjacencyOffsets[Welded[Index] + 1]++;
+		}
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			AdjacencyOffsets[VertexIndex + 1] += AdjacencyOffsets[VertexIndex];
+		}
+		Adjacency.Reset();
+		Adjacency.AddUninitialized(CurrentIndices.Num());
+		{
+			TArray<int32> Cursors = AdjacencyOffsets;
+			for (int32 Index = 0; Index < CurrentIndices.Num(); Index++)
+			{
+				Adjacency[Cursors[Welded[CurrentIndices[Index]]]++] = Index / 3;
+			}
+		}
+
+		bTouched.Reset();
+		bTouched.AddZeroed(NumVertices);
+
+		int32 RemainingTriangles = NumTriangles;
+		int32 NumCollapsed = 0;
+
+		for (const FglTFRuntimeSimplifierCollapse& Collapse : Collapses)
+		{
+			if (RemainingTriangles <= TargetTriangles)
+			{
+				break;
+			}
+
+			if (bTouched[Collapse.From] || bTouched[Collapse.To])
+			{
+				continue;
+			}
+
+			// reject collapses flipping (or excessively rotating) the surviving triangles
+			bool bValid = true;
+			int32 NumRemoved = 0;
+			for (int32 AdjacencyIndex = AdjacencyOffsets[Collapse.From]; AdjacencyIndex < AdjacencyOffsets[Collapse.From + 1]; AdjacencyIndex++)
+			{
+				const int32 TriangleIndex = Adjacency[AdjacencyIndex];
+				int32 Triangle[3];
+				bool bContainsTo = false;
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					Triangle[Corner] = Welded[CurrentIndices[TriangleIndex * 3 + Corner]];
+					bContainsTo |= Triangle[Corner] == Collapse.To;
+				}
+
+				if (bContainsTo)
+				{
+					NumRemoved++;
+					continue;
+				}
+
+				FVector Moved[3];
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					Moved[Corner] = ScaledPositions[Triangle[Corner] == Collapse.From ? Collapse.To : Triangle[Corner]];
+				}
+
+				const FVector OldNormal = FVector::CrossProduct(ScaledPositions[Triangle[1]] - ScaledPositions[Triangle[0]], ScaledPositions[Triangle[2]] - ScaledPositions[Triangle[0]]);
+				const FVector NewNormal = FVector::CrossProduct(Moved[1] - Moved[0], Moved[2] - Moved[0]);
+				if (FVector::DotProduct(OldNormal, NewNormal) < 0.25 * OldNormal.Size() * NewNormal.Size())
+				{
+					bValid = false;
+					break;
+				}
+			}
+
+			if (!bValid)
+			{
+				continue;
+			}
+
+			// the From vertex has a single wedge (seams are locked)
+			for (int32 AdjacencyIndex = AdjacencyOffsets[Collapse.From]; AdjacencyIndex < AdjacencyOffsets[Collapse.From + 1]; AdjacencyIndex++)
+			{
+				const int32 TriangleIndex = Adjacency[AdjacencyIndex];
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					const uint32 Wedge = CurrentIndices[TriangleIndex * 3 + Corner];
+					if (Welded[Wedge] == Collapse.From)
+					{
+						CollapseTarget[Wedge] = Collapse.ToWedge;
+					}
+					bTouched[Welded[Wedge]] = true;
+				}
+			}
+
+			Quadrics[Collapse.To].Add(Quadrics[Collapse.From]);
+			bTouched[Collapse.To] = true;
+
+			RemainingTriangles -= NumRemoved;
+			ResultError = FMath::Max(ResultError, Collapse.Error);
+			NumCollapsed++;
+		}
+
+		if (NumCollapsed == 0)
+		{
+			break;
+		}
+
+		NextIndices.Reset();
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			const uint32 A = CollapseTarget[CurrentIndices[TriangleIndex * 3]];
+			const uint32 B = CollapseTarget[CurrentIndices[TriangleIndex * 3 + 1]];
+			const uint32 C = CollapseTarget[CurrentIndices[TriangleIndex * 3 + 2]];
+			if (Welded[A] == Welded[B] || Welded[B] == Welded[C] || Welded[A] == Welded[C])
+			{
+				continue;
+			}
+			NextIndices.Add(A);
+			NextIndices.Add(B);
+			NextIndices.Add(C);
+		}
+
+		Swap(CurrentIndices, NextIndices);
+	}
+
+	Indices = MoveTemp(CurrentIndices);
+
+	return FMath::Sqrt(ResultError);
+}
+
+void FglTFRuntimeParser::GenerateStaticMeshLODs(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_GenerateStaticMeshLODs, FColor::Magenta);
+
+	const TArray<FglTFRuntimeLODGenerationConfig>& GeneratedLODs = StaticMeshContext->StaticMeshConfig.GeneratedLODs;
+
+	// only single LOD assets are simplified (MSFT_lod or LoadStaticMeshLODs already provide the chain)
+	if (GeneratedLODs.Num() == 0 || StaticMeshContext->LODs.Num() != 1)
+	{
+		return;
+	}
+
+	const FglTFRuntimeMeshLOD* SourceLOD = StaticMeshContext->LODs[0];
+
+	const int32 FirstLOD = StaticMeshContext->GeneratedRuntimeMeshLODs.Num();
+	for (int32 Index = 0; Index < GeneratedLODs.Num(); Index++)
+	{
+		StaticMeshContext->GeneratedRuntimeMeshLODs.Add(MakeUnique<FglTFRuntimeMeshLOD>());
+	}
+
+	TArray<float> Errors;
+	Errors.AddZeroed(GeneratedLODs.Num());
+
+	// every LOD is generated from LOD0
+	ParallelFor(GeneratedLODs.Num(), [&](const int32 Index)
+		{
+			const FglTFRuntimeLODGenerationConfig& LODConfig = GeneratedLODs[Index];
+			FglTFRuntimeMeshLOD& LOD = *StaticMeshContext->GeneratedRuntimeMeshLODs[FirstLOD + Index];
+			LOD.AdditionalTransforms = SourceLOD->AdditionalTransforms;
+			// only the indices are simplified, vertex attributes are not copied
+			LOD.SharedAttributesLOD = SourceLOD;
+
+			const TArray<FVector2D> NoUVs;
+			for (const FglTFRuntimePrimitive& SourcePrimitive : SourceLOD->Primitives)
+			{
+				FglTFRuntimePrimitive& Primitive = LOD.Primitives.AddDefaulted_GetRef();
+				Primitive.Mode = SourcePrimitive.Mode;
+				Primitive.Indices = SourcePrimitive.Indices;
+				// points and lines
+				if (Primitive.Mode < 4)
+				{
+					continue;
+				}
+
+				const int32 TargetNumTriangles = FMath::CeilToInt((Primitive.Indices.Num() / 3) * FMath::Clamp(LODConfig.TriangleRatio, 0.f, 1.f));
+				const float Error = SimplifyIndices(Primitive.Indices, SourcePrimitive.Positions, SourcePrimitive.Normals, SourcePrimitive.UVs.Num() > 0 ? SourcePrimitive.UVs[0] : NoUVs,
+					TargetNumTriangles, LODConfig.MaxError, LODConfig.AttributesWeight);
+				Errors[Index] = FMath::Max(Errors[Index], Error);
+			}
+		});
+
+	int32 NumSourceTriangles = 0;
+	for (const FglTFRuntimePrimitive& Primitive : SourceLOD->Primitives)
+	{
+		NumSourceTriangles += Primitive.Indices.Num() / 3;
+	}
+
+	for (int32 Index = 0; Index < GeneratedLODs.Num(); Index++)
+	{
+		const FglTFRuntimeMeshLOD* LOD = StaticMeshContext->GeneratedRuntimeMeshLODs[FirstLOD + Index].Get();
+		int32 NumTriangles = 0;
+		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
+		{
+			NumTriangles += Primitive.Indices.Num() / 3;
+		}
+
+		UE_LOG(LogGLTFRuntime, Log, TEXT("StaticMesh LOD %d generated: %d -> %d triangles (error %f)"), StaticMeshContext->LODs.Num(), NumSourceTriangles, NumTriangles, Errors[Index]);
+		StaticMeshContext->LODs.Add(LOD);
+	}
+}
@@ -0,0 +1,681 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+
+/*
+* EXT_meshopt_compression bitstream decoders (ATTRIBUTES, TRIANGLES and INDICES modes) and filters.
+* They follow the meshoptimizer reference implementation: no allocations (fixed size blocks and fifos),
+* a single bounds check per byte group/triangle/index (the stream tail guarantees the remaining reads)
+* and branchless group decoding (SSSE3 shuffles when available).
+*/
+
+#if defined(PLATFORM_ALWAYS_HAS_SSE4_1) && PLATFORM_ALWAYS_HAS_SSE4_1
+#define GLTFRUNTIME_MESHOPT_SSSE3 1
+#include <tmmintrin.h>
+#else
+#define GLTFRUNTIME_MESHOPT_SSSE3 0
+#endif
+
+static constexpr int64 glTFRuntimeMeshoptByteGroupSize = 16;
+// max bytes read by a byte group (8 selectors + 16 escaped bytes)
+static constexpr int64 glTFRuntimeMeshoptByteGroupDecodeLimit = 24;
+static constexpr int64 glTFRuntimeMeshoptVertexBlockSizeBytes = 8192;
+static constexpr int64 glTFRuntimeMeshoptVertexBlockMaxSize = 256;
+static constexpr int64 glTFRuntimeMeshoptTailMaxSize = 32;
+
+#if GLTFRUNTIME_MESHOPT_SSSE3
+struct FglTFRuntimeMeshoptShuffleTables
+{
+	// for each 8 bit escape mask, the shuffle moving the escaped bytes in place and their number
+	uint8 Shuffle[256][8];
+	uint8 Count[256];
+
+	FglTFRuntimeMeshoptShuffleTables()
+	{
+		for (int32 Mask = 0; Mask < 256; Mask++)
+		{
+			uint8 NumEscaped = 0;
+			for (int32 Lane = 0; Lane < 8; Lane++)
+			{
+				const bool bEscaped = ((Mask >> Lane) & 1) != 0;
+				Shuffle[Mask][Lane] = bEscaped ? NumEscaped : 0x80;
+				NumEscaped += bEscaped ? 1 : 0;
+			}
+			Count[Mask] = NumEscaped;
+		}
+	}
+};
+
+static const FglTFRuntimeMeshoptShuffleTables& glTFRuntimeMeshoptGetShuffleTables()
+{
+	static const FglTFRuntimeMeshoptShuffleTables Tables;
+	return Tables;
+}
+
+static FORCEINLINE const uint8* glTFRuntimeMeshoptDecodeBytesGroup(const FglTFRuntimeMeshoptShuffleTables& Tables, const uint8* Data, uint8* Destination, const int32 Bits)
+{
+	switch (Bits)
+	{
+	case 0:
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination), _mm_setzero_si128());
+		return Data;
+	case 1:
+	case 2:
+	{
+		__m128i Selectors;
+		__m128i EscapeValue;
+		int64 SelectorsSize;
+		if (Bits == 1)
+		{
+			int32 Selectors2;
+			FMemory::Memcpy(&Selectors2, Data, sizeof(int32));
+			const __m128i Selectors2Vector = _mm_cvtsi32_si128(Selectors2);
+			// expand the 2 bit selectors to bytes (high bits first)
+			const __m128i Selectors22 = _mm_unpacklo_epi8(_mm_srli_epi16(Selectors2Vector, 4), Selectors2Vector);
+			const __m128i Selectors2222 = _mm_unpacklo_epi8(_mm_srli_epi16(Selectors22, 2), Selectors22);
+			EscapeValue = _mm_set1_epi8(3);
+			Selectors = _mm_and_si128(Selectors2222, EscapeValue);
+			SelectorsSize = 4;
+		}
+		else
+		{
+			const __m128i Selectors4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Data));
+			const __m128i Selectors44 = _mm_unpacklo_epi8(_mm_srli_epi16(Selectors4, 4), Selectors4);
+			EscapeValue = _mm_set1_epi8(15);
+			Selectors = _mm_and_si128(Selectors44, EscapeValue);
+			SelectorsSize = 8;
+		}
+
+		const __m128i Escaped = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + SelectorsSize));
+
+		const __m128i EscapeMask = _mm_cmpeq_epi8(Selectors, EscapeValue);
+		const int32 EscapeMask16 = _mm_movemask_epi8(EscapeMask);
+		const uint8 EscapeMask0 = static_cast<uint8>(EscapeMask16 & 0xFF);
+		const uint8 EscapeMask1 = static_cast<uint8>(EscapeMask16 >> 8);
+
+		const __m128i Shuffle0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Tables.Shuffle[EscapeMask0]));
+		const __m128i Shuffle1 = _mm_add_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Tables.Shuffle[EscapeMask1])), _mm_set1_epi8(Tables.Count[EscapeMask0]));
+		const __m128i Shuffle = _mm_unpacklo_epi64(Shuffle0, Shuffle1);
+
+		const __m128i Result = _mm_or_si128(_mm_shuffle_epi8(Escaped, Shuffle), _mm_andnot_si128(EscapeMask, Selectors));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination), Result);
+
+		return Data + SelectorsSize + Tables.Count[EscapeMask0] + Tables.Count[EscapeMask1];
+	}
+	default:
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data)));
+		return Data + glTFRuntimeMeshoptByteGroupSize;
+	}
+}
+#else
+template<int32 Bits>
+static FORCEINLINE const uint8* glTFRuntimeMeshoptDecodeSelectors(const uint8* Data, uint8* Destination)
+{
+	constexpr int32 SelectorsSize = Bits * 2;
+	constexpr uint8 EscapeValue = (1 << Bits) - 1;
+
+	// escaped values follow the selectors
+	const uint8* Escaped = Data + SelectorsSize;
+	for (int32 SelectorIndex = 0; SelectorIndex < SelectorsSize; SelectorIndex++)
+	{
+		const uint8 Byte = Data[SelectorIndex];
+		for (int32 Shift = 8 - Bits; Shift >= 0; Shift -= Bits)
+		{
+			const uint8 Selector = (Byte >> Shift) & EscapeValue;
+			const bool bEscaped = Selector == EscapeValue;
+			*Destination++ = bEscaped ? *Escaped : Selector;
+			Escaped += bEscaped ? 1 : 0;
+		}
+	}
+	return Escaped;
+}
+
+static FORCEINLINE const uint8* glTFRuntimeMeshoptDecodeBytesGroup(const uint8* Data, uint8* Destination, const int32 Bits)
+{
+	switch (Bits)
+	{
+	case 0:
+		FMemory::Memzero(Destination, glTFRuntimeMeshoptByteGroupSize);
+		return Data;
+	case 1:
+		return glTFRuntimeMeshoptDecodeSelectors<2>(Data, Destination);
+	case 2:
+		return glTFRuntimeMeshoptDecodeSelectors<4>(Data, Destination);
+	default:
+		FMemory::Memcpy(Destination, Data, glTFRuntimeMeshoptByteGroupSize);
+		return Data + glTFRuntimeMeshoptByteGroupSize;
+	}
+}
+#endif
+
+static const uint8* glTFRuntimeMeshoptDecodeBytes(const uint8* Data, const uint8* DataEnd, uint8* Destination, const int64 Num)
+{
+#if GLTFRUNTIME_MESHOPT_SSSE3
+	const FglTFRuntimeMeshoptShuffleTables& Tables = glTFRuntimeMeshoptGetShuffleTables();
+#endif
+
+	// 2 bits per group
+	const int64 HeaderSize = (Num / glTFRuntimeMeshoptByteGroupSize + 3) / 4;
+	if (DataEnd - Data < HeaderSize)
+	{
+		return nullptr;
+	}
+
+	const uint8* Header = Data;
+	Data += HeaderSize;
+
+	for (int64 GroupIndex = 0; GroupIndex * glTFRuntimeMeshoptByteGroupSize < Num; GroupIndex++)
+	{
+		if (DataEnd - Data < glTFRuntimeMeshoptByteGroupDecodeLimit)
+		{
+			return nullptr;
+		}
+
+		const int32 Bits = (Header[GroupIndex / 4] >> ((GroupIndex % 4) * 2)) & 0x03;
+#if GLTFRUNTIME_MESHOPT_SSSE3
+		Data = glTFRuntimeMeshoptDecodeBytesGroup(Tables, Data, Destination + GroupIndex * glTFRuntimeMeshoptByteGroupSize, Bits);
+#else
+		Data = glTFRuntimeMeshoptDecodeBytesGroup(Data, Destination + GroupIndex * glTFRuntimeMeshoptByteGroupSize, Bits);
+#endif
+	}
+
+	return Data;
+}
+
+bool FglTFRuntimeParser::DecodeMeshoptVertexBuffer(uint8* Destination, const int64 Elements, const int64 Stride, const uint8* Source, const int64 SourceSize)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecodeMeshoptVertexBuffer, FColor::Magenta);
+
+	if (Stride <= 0 || Stride > 256 || (Stride % 4) != 0 || Elements < 0)
+	{
+		return false;
+	}
+
+	const int64 TailSize = FMath::Max(Stride, glTFRuntimeMeshoptTailMaxSize);
+	if (SourceSize < 1 + TailSize || Source[0] != 0xa0)
+	{
+		return false;
+	}
+
+	const uint8* Data = Source + 1;
+	const uint8* DataEnd = Source + SourceSize;
+
+	// the baseline is stored at the end of the tail
+	uint8 LastVertex[256];
+	FMemory::Memcpy(LastVertex, DataEnd - Stride, Stride);
+
+	uint8 Deltas[glTFRuntimeMeshoptVertexBlockMaxSize];
+
+	const int64 BlockSize = FMath::Min((glTFRuntimeMeshoptVertexBlockSizeBytes / Stride) & ~(glTFRuntimeMeshoptByteGroupSize - 1), glTFRuntimeMeshoptVertexBlockMaxSize);
+
+	for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex += BlockSize)
+	{
+		const int64 BlockElements = FMath::Min(BlockSize, Elements - ElementIndex);
+		const int64 AlignedBlockElements = (BlockElements + glTFRuntimeMeshoptByteGroupSize - 1) & ~(glTFRuntimeMeshoptByteGroupSize - 1);
+		uint8* BlockDestination = Destination + ElementIndex * Stride;
+
+		// each byte lane is stored separately
+		for (int64 ByteIndex = 0; ByteIndex < Stride; ByteIndex++)
+		{
+			Data = glTFRuntimeMeshoptDecodeBytes(Data, DataEnd, Deltas, AlignedBlockElements);
+			if (!Data)
+			{
+				return false;
+			}
+
+			uint8* Output = BlockDestination + ByteIndex;
+			uint8 Value = LastVertex[ByteIndex];
+			for (int64 DeltaIndex = 0; DeltaIndex < BlockElements; DeltaIndex++)
+			{
+				const uint8 Delta = Deltas[DeltaIndex];
+				Value += static_cast<uint8>((Delta >> 1) ^ -static_cast<int32>(Delta & 1));
+				*Output = Value;
+				Output += Stride;
+			}
+			LastVertex[ByteIndex] = Value;
+		}
+	}
+
+	return DataEnd - Data == TailSize;
+}
+
+static FORCEINLINE uint32 glTFRuntimeMeshoptDecodeVByte(const uint8*& Data)
+{
+	const uint8 Lead = *Data++;
+	if (Lead < 0x80)
+	{
+		return Lead;
+	}
+
+	// up to 5 bytes
+	uint32 Result = Lead & 0x7F;
+	int32 Shift = 7;
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		const uint8 Group = *Data++;
+		Result |= static_cast<uint32>(Group & 0x7F) << Shift;
+		Shift += 7;
+		if (Group < 0x80)
+		{
+			break;
+		}
+	}
+
+	return Result;
+}
+
+static FORCEINLINE uint32 glTFRuntimeMeshoptDecodeIndex(const uint8*& Data, const uint32 Last)
+{
+	const uint32 Value = glTFRuntimeMeshoptDecodeVByte(Data);
+	return Last + ((Value >> 1) ^ (0 - (Value & 1)));
+}
+
+static FORCEINLINE void glTFRuntimeMeshoptPushEdge(uint32 EdgeFifo[16][2], const uint32 A, const uint32 B, uint32& Offset)
+{
+	EdgeFifo[Offset][0] = A;
+	EdgeFifo[Offset][1] = B;
+	Offset = (Offset + 1) & 15;
+}
+
+static FORCEINLINE void glTFRuntimeMeshoptPushVertex(uint32 VertexFifo[16], const uint32 Vertex, uint32& Offset, const uint32 bPush = 1)
+{
+	// the slot is always written, the offset moves only when pushing
+	VertexFifo[Offset] = Vertex;
+	Offset = (Offset + bPush) & 15;
+}
+
+template<typename T>
+static bool glTFRuntimeMeshoptDecodeIndexBuffer(T* Destination, const int64 Elements, const uint8* Source, const int64 SourceSize)
+{
+	// header, 1 byte per triangle and the 16 bytes codeaux table
+	if ((Elements % 3) != 0 || SourceSize < 1 + Elements / 3 + 16)
+	{
+		return false;
+	}
+
+	if ((Source[0] & 0xF0) != 0xe0)
+	{
+		return false;
+	}
+
+	const int32 Version = Source[0] & 0x0F;
+	if (Version > 1)
+	{
+		return false;
+	}
+
+	uint32 EdgeFifo[16][2];
+	uint32 VertexFifo[16];
+	FMemory::Memset(EdgeFifo, 0xFF, sizeof(EdgeFifo));
+	FMemory::Memset(VertexFifo, 0xFF, sizeof(VertexFifo));
+
+	uint32 EdgeFifoOffset = 0;
+	uint32 VertexFifoOffset = 0;
+
+	uint32 Next = 0;
+	uint32 Last = 0;
+
+	// version 1 uses 13 and 14 for the last index +/- 1
+	const int32 MaxFifoCode = Version >= 1 ? 13 : 15;
+
+	const uint8* Code = Source + 1;
+	const uint8* Data = Code + Elements / 3;
+	const uint8* DataSafeEnd = Source + SourceSize - 16;
+	const uint8* CodeAuxTable = DataSafeEnd;
+
+	for (int64 Index = 0; Index < Elements; Index += 3)
+	{
+		// a triangle reads at most 16 bytes (1 for codeaux and 5 for each free index)
+		if (Data > DataSafeEnd)
+		{
+			return false;
+		}
+
+		const uint8 CodeTriangle = *Code++;
+
+		if (CodeTriangle < 0xF0)
+		{
+			const int32 EdgeCode = CodeTriangle >> 4;
+			const uint32 A = EdgeFifo[(EdgeFifoOffset - 1 - EdgeCode) & 15][0];
+			const uint32 B = EdgeFifo[(EdgeFifoOffset - 1 - EdgeCode) & 15][1];
+
+			const int32 VertexCode = CodeTriangle & 0x0F;
+			if (VertexCode < MaxFifoCode)
+			{
+				const uint32 FifoVertex = VertexFifo[(VertexFifoOffset - 1 - VertexCode) & 15];
+				const uint32 bNewVertex = VertexCode == 0 ? 1 : 0;
+				const uint32 C = bNewVertex ? Next : FifoVertex;
+				Next += bNewVertex;
+
+				Destination[Index] = static_cast<T>(A);
+				Destination[Index + 1] = static_cast<T>(B);
+				Destination[Index + 2] = static_cast<T>(C);
+
+				glTFRuntimeMeshoptPushVertex(VertexFifo, C, VertexFifoOffset, bNewVertex);
+				glTFRuntimeMeshoptPushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+				glTFRuntimeMeshoptPushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+			}
+			else
+			{
+				// 13 and 14 are decoded as -1 and +1
+				const uint32 C = VertexCode != 15 ? Last + (VertexCode - (VertexCode ^ 3)) : glTFRuntimeMeshoptDecodeIndex(Data, Last);
+				Last = C;
+
+				Destination[Index] = static_cast<T>(A);
+				Destination[Index + 1] = static_cast<T>(B);
+				Destination[Index + 2] = static_cast<T>(C);
+
+				glTFRuntimeMeshoptPushVertex(VertexFifo, C, VertexFifoOffset);
+				glTFRuntimeMeshoptPushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+				glTFRuntimeMeshoptPushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+			}
+		}
+		else if (CodeTriangle < 0xFE)
+		{
+			// codeaux from the table (it can not contain free indices)
+			const uint8 CodeAux = CodeAuxTable[CodeTriangle & 0x0F];
+			const int32 CodeB = CodeAux >> 4;
+			const int32 CodeC = CodeAux & 0x0F;
+
+			const uint32 A = Next++;
+
+			const uint32 FifoB = VertexFifo[(VertexFifoOffset - CodeB) & 15];
+			const uint32 bNewB = CodeB == 0 ? 1 : 0;
+			const uint32 B = bNewB ? Next : FifoB;
+			Next += bNewB;
+
+			const uint32 FifoC = VertexFifo[(VertexFifoOffset - CodeC) & 15];
+			const uint32 bNewC = CodeC == 0 ? 1 : 0;
+			const uint32 C = bNewC ? Next : FifoC;
+			Next += bNewC;
+
+			Destination[Index] = static_cast<T>(A);
+			Destination[Index + 1] = static_cast<T>(B);
+			Destination[Index + 2] = static_cast<T>(C);
+
+			glTFRuntimeMeshoptPushVertex(VertexFifo, A, VertexFifoOffset);
+			glTFRuntimeMeshoptPushVertex(VertexFifo, B, VertexFifoOffset, bNewB);
+			glTFRuntimeMeshoptPushVertex(VertexFifo, C, VertexFifoOffset, bNewC);
+
+			glTFRuntimeMeshoptPushEdge(EdgeFifo, B, A, EdgeFifoOffset);
+			glTFRuntimeMeshoptPushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+			glTFRuntimeMeshoptPushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+		}
+		else
+		{
+			// codeaux from the data stream
+			const uint8 CodeAux = *Data++;
+			const int32 CodeA = CodeTriangle == 0xFE ? 0 : 15;
+			const int32 CodeB = CodeAux >> 4;
+			const int32 CodeC = CodeAux & 0x0F;
+
+			if (CodeAux == 0)
+			{
+				Next = 0;
+			}
+
+			uint32 A = CodeA == 0 ? Next++ : 0;
+			uint32 B = CodeB == 0 ? Next++ : VertexFifo[(VertexFifoOffset - CodeB) & 15];
+			uint32 C = CodeC == 0 ? Next++ : VertexFifo[(VertexFifoOffset - CodeC) & 15];
+
+			if (CodeA == 15)
+			{
+				Last = A = glTFRuntimeMeshoptDecodeIndex(Data, Last);
+			}
+
+			if (CodeB == 15)
+			{
+				Last = B = glTFRuntimeMeshoptDecodeIndex(Data, Last);
+			}
+
+			if (CodeC == 15)
+			{
+				Last = C = glTFRuntimeMeshoptDecodeIndex(Data, Last);
+			}
+
+			Destination[Index] = static_cast<T>(A);
+			Destination[Index + 1] = static_cast<T>(B);
+			Destination[Index + 2] = static_cast<T>(C);
+
+			glTFRuntimeMeshoptPushVertex(VertexFifo, A, VertexFifoOffset);
+			glTFRuntimeMeshoptPushVertex(VertexFifo, B, VertexFifoOffset, (CodeB == 0 || CodeB == 15) ? 1 : 0);
+			glTFRuntimeMeshoptPushVertex(VertexFifo, C, VertexFifoOffset, (CodeC == 0 || CodeC == 15) ? 1 : 0);
+
+			glTFRuntimeMeshoptPushEdge(EdgeFifo, B, A, EdgeFifoOffset);
+			glTFRuntimeMeshoptPushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+			glTFRuntimeMeshoptPushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+		}
+	}
+
+	// all of the data must be consumed
+	return Data == DataSafeEnd;
+}
+
+bool FglTFRuntimeParser::DecodeMeshoptIndexBuffer(uint8* Destination, const int64 Elements, const int64 Stride, const uint8* Source, const int64 SourceSize)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecodeMeshoptIndexBuffer, FColor::Magenta);
+
+	if (Stride == 2)
+	{
+		return glTFRuntimeMeshoptDecodeIndexBuffer(reinterpret_cast<uint16*>(Destination), Elements, Source, SourceSize);
+	}
+	else if (Stride == 4)
+	{
+		return glTFRuntimeMeshoptDecodeIndexBuffer(reinterpret_cast<uint32*>(Destination), Elements, Source, SourceSize);
+	}
+
+	return false;
+}
+
+template<typename T>
+static bool glTFRuntimeMeshoptDecodeIndexSequence(T* Destination, const int64 Elements, const uint8* Source, const int64 SourceSize)
+{
+	// header, 1 byte per index and the 4 bytes tail
+	if (SourceSize < 1 + Elements + 4)
+	{
+		return false;
+	}
+
+	if ((Source[0] & 0xF0) != 0xd0 || (Source[0] & 0x0F) > 1)
+	{
+		return false;
+	}
+
+	const uint8* Data = Source + 1;
+	const uint8* DataSafeEnd = Source + SourceSize - 4;
+
+	uint32 Last[2] = { 0, 0 };
+
+	for (int64 Index = 0; Index < Elements; Index++)
+	{
+		// an index reads at most 5 bytes (the tail covers the remaining ones)
+		if (Data >= DataSafeEnd)
+		{
+			return false;
+		}
+
+		uint32 Value = glTFRuntimeMeshoptDecodeVByte(Data);
+
+		// the lowest bit selects the baseline
+		const uint32 Baseline = Value & 1;
+		Value >>= 1;
+
+		const uint32 Current = Last[Baseline] + ((Value >> 1) ^ (0 - (Value & 1)));
+		Last[Baseline] = Current;
+
+		Destination[Index] = static_cast<T>(Current);
+	}
+
+	return Data == DataSafeEnd;
+}
+
+bool FglTFRuntimeParser::DecodeMeshoptIndexSequence(uint8* Destination, const int64 Elements, const int64 Stride, const uint8* Source, const int64 SourceSize)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecodeMeshoptIndexSequence, FColor::Magenta);
+
+	if (Stride == 2)
+	{
+		return glTFRuntimeMeshoptDecodeIndexSequence(reinterpret_cast<uint16*>(Destination), Elements, Source, SourceSize);
+	}
+	else if (Stride == 4)
+	{
+		return glTFRuntimeMeshoptDecodeIndexSequence(reinterpret_cast<uint32*>(Destination), Elements, Source, SourceSize);
+	}
+
+	return false;
+}
+
+// filters are branchless (selects only) to allow the compiler to vectorize them
+
+template<typename T>
+static void glTFRuntimeMeshoptDecodeFilterOctahedral(T* Data, const int64 Elements)
+{
+	constexpr float Max = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+
+	for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex++)
+	{
+		T* Element = Data + ElementIndex * 4;
+
+		// z stores 1.0 using the same number of bits
+		float X = Element[0];
+		float Y = Element[1];
+		const float Z = Element[2] - FMath::Abs(X) - FMath::Abs(Y);
+
+		const float Fixup = Z >= 0 ? 0.0f : Z;
+		X += X >= 0 ? Fixup : -Fixup;
+		Y += Y >= 0 ? Fixup : -Fixup;
+
+		const float Scale = Max / FMath::Sqrt(X * X + Y * Y + Z * Z);
+
+		Element[0] = static_cast<T>(static_cast<int32>(X * Scale + (X >= 0 ? 0.5f : -0.5f)));
+		Element[1] = static_cast<T>(static_cast<int32>(Y * Scale + (Y >= 0 ? 0.5f : -0.5f)));
+		Element[2] = static_cast<T>(static_cast<int32>(Z * Scale + (Z >= 0 ? 0.5f : -0.5f)));
+	}
+}
+
+static void glTFRuntimeMeshoptDecodeFilterQuaternion(int16* Data, const int64 Elements)
+{
+	const float Range = 1.0f / FMath::Sqrt(2.0f);
+
+	for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex++)
+	{
+		int16* Element = Data + ElementIndex * 4;
+
+		// the scale is in the high bits of the last component
+		const float Scale = Range / static_cast<float>(Element[3] | 3);
+
+		const float X = Element[0] * Scale;
+		const float Y = Element[1] * Scale;
+		const float Z = Element[2] * Scale;
+
+		const float WW = 1.0f - X * X - Y * Y - Z * Z;
+		const float W = FMath::Sqrt(WW >= 0 ? WW : 0.0f);
+
+		const int16 XI = static_cast<int16>(static_cast<int32>(X * 32767.0f + (X >= 0 ? 0.5f : -0.5f)));
+		const int16 YI = static_cast<int16>(static_cast<int32>(Y * 32767.0f + (Y >= 0 ? 0.5f : -0.5f)));
+		const int16 ZI = static_cast<int16>(static_cast<int32>(Z * 32767.0f + (Z >= 0 ? 0.5f : -0.5f)));
+		const int16 WI = static_cast<int16>(static_cast<int32>(W * 32767.0f + 0.5f));
+
+		// the max component index is in the 2 lowest bits
+		const int32 MaxComponent = Element[3] & 3;
+		Element[(MaxComponent + 1) & 3] = XI;
+		Element[(MaxComponent + 2) & 3] = YI;
+		Element[(MaxComponent + 3) & 3] = ZI;
+		Element[(MaxComponent + 0) & 3] = WI;
+	}
+}
+
+static void glTFRuntimeMeshoptDecodeFilterExponential(uint32* Data, const int64 Num)
+{
+	for (int64 Index = 0; Index < Num; Index++)
+	{
+		const uint32 Value = Data[Index];
+
+		// signed 8 bit exponent and signed 24 bit mantissa
+		const int32 Mantissa = static_cast<int32>(Value << 8) >> 8;
+		const int32 Exponent = static_cast<int32>(Value) >> 24;
+
+		// ldexp(Mantissa, Exponent) without the function call
+		const uint32 ScaleBits = static_cast<uint32>(Exponent + 127) << 23;
+		float Scale;
+		FMemory::Memcpy(&Scale, &ScaleBits, sizeof(float));
+
+		const float Result = Scale * static_cast<float>(Mantissa);
+		FMemory::Memcpy(&Data[Index], &Result, sizeof(float));
+	}
+}
+
+bool FglTFRuntimeParser::DecodeMeshoptFilter(uint8* Data, const int64 Elements, const int64 Stride, const FString& Filter)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecodeMeshoptFilter, FColor::Magenta);
+
+	if (Filter.IsEmpty() || Filter == "NONE")
+	{
+		return true;
+	}
+
+	if (Filter == "OCTAHEDRAL" && Stride == 4)
+	{
+		glTFRuntimeMeshoptDecodeFilterOctahedral(reinterpret_cast<int8*>(Data), Elements);
+		return true;
+	}
+
+	if (Filter == "OCTAHEDRAL" && Stride == 8)
+	{
+		glTFRuntimeMeshoptDecodeFilterOctahedral(reinterpret_cast<int16*>(Data), Elements);
+		return true;
+	}
+
+	if (Filter == "QUATERNION" && Stride == 8)
+	{
+		glTFRuntimeMeshoptDecodeFilterQuaternion(reinterpret_cast<int16*>(Data), Elements);
+		return true;
+	}
+
+	if (Filter == "EXPONENTIAL" && (Stride % 4) == 0)
+	{
+		glTFRuntimeMeshoptDecodeFilterExponential(reinterpret_cast<uint32*>(Data), Elements * Stride / 4);
+		return true;
+	}
+
+	return false;
+}
+
+bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecompressMeshOptimizer, FColor::Magenta);
+
+	if (Stride <= 0 || Elements < 0)
+	{
+		return false;
+	}
+
+	UncompressedBytes.SetNumUninitialized(Elements * Stride);
+
+	bool bSuccess = false;
+	if (Mode == "ATTRIBUTES")
+	{
+		bSuccess = DecodeMeshoptVertexBuffer(UncompressedBytes.GetData(), Elements, Stride, Blob.Data, Blob.Num);
+	}
+	else if (Mode == "TRIANGLES")
+	{
+		bSuccess = DecodeMeshoptIndexBuffer(UncompressedBytes.GetData(), Elements, Stride, Blob.Data, Blob.Num);
+	}
+	else if (Mode == "INDICES")
+	{
+		bSuccess = DecodeMeshoptIndexSequence(UncompressedBytes.GetData(), Elements, Stride, Blob.Data, Blob.Num);
+	}
+
+	if (!bSuccess)
+	{
+		return false;
+	}
+
+	if (UncompressedBytes.Num() > 0 && !DecodeMeshoptFilter(UncompressedBytes.GetData(), Elements, Stride, Filter))
+	{
+		AddError("DecompressMeshOptimizer()", "Unsupported Filter");
+		return false;
+	}
+
+	return true;
+}
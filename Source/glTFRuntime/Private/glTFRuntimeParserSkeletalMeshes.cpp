@@ -35,6 +35,9 @@
 #include "Model.h"
 #include "Animation/MorphTarget.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "glTFRuntimeTaskScheduler.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "Animation/AnimCurveTypes.h"
 #include "PhysicsEngine/PhysicsAsset.h"
 #include "PhysicsEngine/PhysicsConstraintTemplate.h"
@@ -50,6 +53,60 @@
 #define MAX_BONE_INFLUENCE_WEIGHT 0xff
 #endif
 
+struct FglTFRuntimeBoneInfluence
+{
+	int32 BoneIndex;
+	float Weight;
+};
+
+typedef TArray<FglTFRuntimeBoneInfluence, TInlineAllocator<16>> FglTFRuntimeBoneInfluences;
+
+// merge duplicated bones, sort by weight, drop the influences below the threshold (or beyond the max) and renormalize.
+// At least one influence is always kept.
+static void glTFRuntimeCompactBoneInfluences(FglTFRuntimeBoneInfluences& Influences, const int32 MaxInfluences, const float WeightThreshold)
+{
+	for (int32 Index = 0; Index < Influences.Num(); Index++)
+	{
+		for (int32 OtherIndex = Influences.Num() - 1; OtherIndex > Index; OtherIndex--)
+		{
+			if (Influences[OtherIndex].BoneIndex == Influences[Index].BoneIndex)
+			{
+				Influences[Index].Weight += Influences[OtherIndex].Weight;
+				Influences.RemoveAt(OtherIndex, 1, false);
+			}
+		}
+	}
+
+	Influences.StableSort([](const FglTFRuntimeBoneInfluence& A, const FglTFRuntimeBoneInfluence& B) { return A.Weight > B.Weight; });
+
+	const int32 NumCandidates = FMath::Min(Influences.Num(), MaxInfluences);
+	int32 NumInfluences = 0;
+	float TotalWeight = 0;
+	while (NumInfluences < NumCandidates && (NumInfluences == 0 || Influences[NumInfluences].Weight >= WeightThreshold))
+	{
+		TotalWeight += FMath::Max(Influences[NumInfluences].Weight, 0.f);
+		NumInfluences++;
+	}
+
+	Influences.SetNum(NumInfluences, false);
+
+	if (NumInfluences == 0)
+	{
+		return;
+	}
+
+	if (TotalWeight <= 0)
+	{
+		Influences[0].Weight = 1;
+		TotalWeight = 1;
+	}
+
+	for (FglTFRuntimeBoneInfluence& Influence : Influences)
+	{
+		Influence.Weight = FMath::Max(Influence.Weight, 0.f) / TotalWeight;
+	}
+}
+
 struct FglTFRuntimeSkeletalMeshContextFinalizer
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext;
@@ -63,15 +120,16 @@ struct FglTFRuntimeSkeletalMeshContextFinalizer
 
 	~FglTFRuntimeSkeletalMeshContextFinalizer()
 	{
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		// the worker does not wait for the finalization
+		FglTFRuntimeGameThreadQueue::Get().EnqueueResumable([SkeletalMeshContext = SkeletalMeshContext, AsyncCallback = AsyncCallback]()
 			{
-				if (SkeletalMeshContext->SkeletalMesh)
+				if (!SkeletalMeshContext->Parser->FinalizeSkeletalMeshStage(SkeletalMeshContext))
 				{
-					SkeletalMeshContext->SkeletalMesh = SkeletalMeshContext->Parser->FinalizeSkeletalMeshWithLODs(SkeletalMeshContext);
+					return false;
 				}
-		AsyncCallback.ExecuteIfBound(SkeletalMeshContext->SkeletalMesh);
-			}, TStatId(), nullptr, ENamedThreads::GameThread);
-		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+				AsyncCallback.ExecuteIfBound(SkeletalMeshContext->SkeletalMesh);
+				return true;
+			});
 	}
 };
 
@@ -225,7 +283,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 	TMap<int32, FName> MainBoneMap;
 	if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE)
 	{
-		TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex("skins", SkeletalMeshContext->SkinIndex);
+		TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Skins, SkeletalMeshContext->SkinIndex);
 		if (!JsonSkinObject)
 		{
 			AddError("CreateSkeletalMeshFromLODs()", "Unable to fill RefSkeleton.");
@@ -292,6 +350,8 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 	SkeletalMeshContext->SkeletalMesh->ResetLODInfo();
 
 	const float TangentsDirection = SkeletalMeshContext->SkeletalMeshConfig.bReverseTangents ? -1 : 1;
+	const int32 SkinMaxBoneInfluences = FMath::Clamp(SkeletalMeshContext->SkeletalMeshConfig.MaxBoneInfluences, 1, MAX_TOTAL_INFLUENCES);
+	const float BoneInfluencesWeightThreshold = SkeletalMeshContext->SkeletalMeshConfig.BoneInfluencesWeightThreshold;
 
 #if WITH_EDITOR
 
@@ -348,6 +408,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 				if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE)
 				{
+					FglTFRuntimeBoneInfluences VertexInfluences;
 					for (int32 JointsIndex = 0; JointsIndex < Primitive.Joints.Num(); JointsIndex++)
 					{
 						FglTFRuntimeUInt16Vector4 Joints = Primitive.Joints[JointsIndex][PrimitiveIndex];
@@ -357,8 +418,6 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 						{
 							if (BoneMapInUse.Contains(Joints[JointPartIndex]))
 							{
-								SkeletalMeshImportData::FRawBoneInfluence Influence;
-								Influence.VertexIndex = Wedge.VertexIndex;
 								int32 BoneIndex = INDEX_NONE;
 								if (BonesCacheInUse.Contains(Joints[JointPartIndex]))
 								{
@@ -373,14 +432,9 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 #endif
 									BonesCacheInUse.Add(Joints[JointPartIndex], BoneIndex);
 								}
-								Influence.BoneIndex = BoneIndex;
-								Influence.Weight = Weights[JointPartIndex];
-								TPair<int32, int32> InfluenceKey = TPair<int32, int32>(Influence.VertexIndex, Influence.BoneIndex);
-								// do not waste cpu time processing zero influences
-								if (!FMath::IsNearlyZero(Influence.Weight, KINDA_SMALL_NUMBER) && !InfluencesMap.Contains(InfluenceKey))
+								if (BoneIndex > INDEX_NONE)
 								{
-									Influences.Add(Influence);
-									InfluencesMap.Add(InfluenceKey);
+									VertexInfluences.Add({ BoneIndex, static_cast<float>(Weights[JointPartIndex]) });
 								}
 							}
 							else if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreMissingBones)
@@ -390,6 +444,22 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 							}
 						}
 					}
+
+					glTFRuntimeCompactBoneInfluences(VertexInfluences, SkinMaxBoneInfluences, BoneInfluencesWeightThreshold);
+
+					for (const FglTFRuntimeBoneInfluence& VertexInfluence : VertexInfluences)
+					{
+						SkeletalMeshImportData::FRawBoneInfluence Influence;
+						Influence.VertexIndex = Wedge.VertexIndex;
+						Influence.BoneIndex = VertexInfluence.BoneIndex;
+						Influence.Weight = VertexInfluence.Weight;
+						TPair<int32, int32> InfluenceKey = TPair<int32, int32>(Influence.VertexIndex, Influence.BoneIndex);
+						if (!InfluencesMap.Contains(InfluenceKey))
+						{
+							Influences.Add(Influence);
+							InfluencesMap.Add(InfluenceKey);
+						}
+					}
 				}
 
 				TriangleIndex++;
@@ -529,113 +599,144 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		if (!SkeletalMeshContext->SkeletalMeshConfig.bDisableMorphTargets)
 		{
 
-			TArray<TSet<uint32>> MorphTargetModifiedPoints;
-			TArray<FSkeletalMeshImportData> MorphTargetsData;
-			TArray<FString> MorphTargetNames;
+			struct FMorphTargetBuildJob
+			{
+				const FglTFRuntimePrimitive* Primitive;
+				const FglTFRuntimeMorphTarget* MorphTarget;
+				int32 PointsBase;
+				bool bEmpty;
+				TSet<uint32> ModifiedPoints;
+#if ENGINE_MAJOR_VERSION > 4
+				TArray<FVector3f> Positions;
+#else
+				TArray<FVector> Positions;
+#endif
+			};
 
-			int32 MorphTargetIndex = 0;
+			TArray<FMorphTargetBuildJob> MorphTargetJobs;
 			int32 PointsBase = 0;
-			TMap<FString, int32> MorphTargetNamesHistory;
-			TMap<FString, int32> MorphTargetNamesDuplicateCounter;
 
-			for (FglTFRuntimePrimitive& Primitive : LOD.RuntimeLOD->Primitives)
+			for (const FglTFRuntimePrimitive& Primitive : LOD.RuntimeLOD->Primitives)
 			{
-				for (FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+				for (const FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+				{
+					FMorphTargetBuildJob& Job = MorphTargetJobs.AddDefaulted_GetRef();
+					Job.Primitive = &Primitive;
+					Job.MorphTarget = &MorphTarget;
+					Job.PointsBase = PointsBase;
+				}
+				PointsBase += Primitive.Positions.Num();
+			}
+
+			const float MorphTargetsDeltaThreshold = SkeletalMeshContext->SkeletalMeshConfig.MorphTargetsDeltaThreshold;
+
+			// every target is built independently, names and duplicates are resolved afterwards
+			ParallelFor(MorphTargetJobs.Num(), [&MorphTargetJobs, MorphTargetsDeltaThreshold](const int32 JobIndex)
 				{
-					TSet<uint32> MorphTargetPoints;
+					FMorphTargetBuildJob& Job = MorphTargetJobs[JobIndex];
+					const TArray<FVector>& BasePositions = Job.Primitive->Positions;
+					const TArray<FVector>& Deltas = Job.MorphTarget->Positions;
+
+					Job.bEmpty = true;
+					Job.Positions.AddUninitialized(BasePositions.Num());
+					Job.ModifiedPoints.Reserve(BasePositions.Num());
+					for (int32 PointIndex = 0; PointIndex < BasePositions.Num(); PointIndex++)
+					{
 #if ENGINE_MAJOR_VERSION > 4
-					TArray<FVector3f> MorphTargetPositions;
+						Job.Positions[PointIndex] = FVector3f(BasePositions[PointIndex] + Deltas[PointIndex]);
 #else
-					TArray<FVector> MorphTargetPositions;
+						Job.Positions[PointIndex] = BasePositions[PointIndex] + Deltas[PointIndex];
 #endif
-					bool bSkip = true;
-					for (uint32 PointIndex = 0; PointIndex < (uint32)Primitive.Positions.Num(); PointIndex++)
-					{
-						MorphTargetPoints.Add(PointsBase + PointIndex);
-						if (!MorphTarget.Positions[PointIndex].IsNearlyZero())
+						// points and positions must stay paired one to one, the threshold only detects empty targets
+						Job.ModifiedPoints.Add(Job.PointsBase + PointIndex);
+						if (Job.bEmpty && !Deltas[PointIndex].IsNearlyZero(MorphTargetsDeltaThreshold))
 						{
-							bSkip = false;
+							Job.bEmpty = false;
+						}
 					}
-#if ENGINE_MAJOR_VERSION > 4
-						MorphTargetPositions.Add(FVector3f(Primitive.Positions[PointIndex] + MorphTarget.Positions[PointIndex]));
-#else
-						MorphTargetPositions.Add(Primitive.Positions[PointIndex] + MorphTarget.Positions[PointIndex]);
-#endif
-			}
+				});
+
+			TArray<TSet<uint32>> MorphTargetModifiedPoints;
+			TArray<FSkeletalMeshImportData> MorphTargetsData;
+			TArray<FString> MorphTargetNames;
+
+			int32 MorphTargetIndex = 0;
+			TMap<FString, int32> MorphTargetNamesHistory;
+			TMap<FString, int32> MorphTargetNamesDuplicateCounter;
+
+			for (FMorphTargetBuildJob& Job : MorphTargetJobs)
+			{
+				if (SkeletalMeshContext->SkeletalMeshConfig.bIgnoreEmptyMorphTargets && Job.bEmpty)
+				{
+					continue;
+				}
+
+				FString MorphTargetName = Job.MorphTarget->Name;
+				if (MorphTargetName.IsEmpty())
+				{
+					MorphTargetName = FString::Printf(TEXT("MorphTarget_%d"), MorphTargetIndex);
+				}
 
-					if (SkeletalMeshContext->SkeletalMeshConfig.bIgnoreEmptyMorphTargets && bSkip)
+				bool bAddMorphTarget = false;
+				if (MorphTargetNamesHistory.Contains(MorphTargetName))
+				{
+					int32 Index = MorphTargetNamesHistory[MorphTargetName];
+					EglTFRuntimeMorphTargetsDuplicateStrategy DuplicateStrategy = SkeletalMeshContext->SkeletalMeshConfig.MorphTargetsDuplicateStrategy;
+					if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Ignore)
 					{
-						continue;
+						// NOP
 					}
-
-					FString MorphTargetName = MorphTarget.Name;
-					if (MorphTargetName.IsEmpty())
+					else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Merge)
 					{
-						MorphTargetName = FString::Printf(TEXT("MorphTarget_%d"), MorphTargetIndex);
+						MorphTargetModifiedPoints[Index].Append(Job.ModifiedPoints);
+						MorphTargetsData[Index].Points.Append(Job.Positions);
 					}
-
-					bool bAddMorphTarget = false;
-					if (MorphTargetNamesHistory.Contains(MorphTargetName))
+					else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendDuplicateCounter)
 					{
-						int32 Index = MorphTargetNamesHistory[MorphTargetName];
-						EglTFRuntimeMorphTargetsDuplicateStrategy DuplicateStrategy = SkeletalMeshContext->SkeletalMeshConfig.MorphTargetsDuplicateStrategy;
-						if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Ignore)
-						{
-							// NOP
-						}
-						else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Merge)
-						{
-							MorphTargetModifiedPoints[Index].Append(MorphTargetPoints);
-							MorphTargetsData[Index].Points.Append(MorphTargetPositions);
-						}
-						else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendDuplicateCounter)
+						if (MorphTargetNamesDuplicateCounter.Contains(MorphTargetName))
 						{
-							if (MorphTargetNamesDuplicateCounter.Contains(MorphTargetName))
-							{
-								MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetNamesDuplicateCounter[MorphTargetName] + 1);
-								MorphTargetNamesDuplicateCounter[MorphTargetName] += 1;
-							}
-							else
-							{
-								MorphTargetName = FString::Printf(TEXT("%s_1"), *MorphTargetName);
-								MorphTargetNamesDuplicateCounter.Add(MorphTargetName, 1);
-							}
-							bAddMorphTarget = true;
+							MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetNamesDuplicateCounter[MorphTargetName] + 1);
+							MorphTargetNamesDuplicateCounter[MorphTargetName] += 1;
 						}
-						else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendMorphIndex)
+						else
 						{
-							MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetIndex);
-							bAddMorphTarget = true;
+							MorphTargetName = FString::Printf(TEXT("%s_1"), *MorphTargetName);
+							MorphTargetNamesDuplicateCounter.Add(MorphTargetName, 1);
 						}
+						bAddMorphTarget = true;
 					}
-					else
+					else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendMorphIndex)
 					{
+						MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetIndex);
 						bAddMorphTarget = true;
 					}
+				}
+				else
+				{
+					bAddMorphTarget = true;
+				}
 
-					if (bAddMorphTarget)
-					{
-						MorphTargetModifiedPoints.Add(MorphTargetPoints);
+				if (bAddMorphTarget)
+				{
+					MorphTargetModifiedPoints.Add(MoveTemp(Job.ModifiedPoints));
 
-						FSkeletalMeshImportData MorphTargetImportData;
-						MorphTargetImportData.PointToRawMap = LOD.ImportData.PointToRawMap;
-						MorphTargetImportData.bDiffPose = LOD.ImportData.bDiffPose;
-						MorphTargetImportData.bUseT0AsRefPose = LOD.ImportData.bUseT0AsRefPose;
-						MorphTargetImportData.Points = MorphTargetPositions;
+					FSkeletalMeshImportData MorphTargetImportData;
+					MorphTargetImportData.PointToRawMap = LOD.ImportData.PointToRawMap;
+					MorphTargetImportData.bDiffPose = LOD.ImportData.bDiffPose;
+					MorphTargetImportData.bUseT0AsRefPose = LOD.ImportData.bUseT0AsRefPose;
+					MorphTargetImportData.Points = MoveTemp(Job.Positions);
 
-						MorphTargetsData.Add(MorphTargetImportData);
+					MorphTargetsData.Add(MoveTemp(MorphTargetImportData));
 
-						MorphTargetNamesHistory.Add(MorphTargetName, MorphTargetNames.Add(MorphTargetName));
-					}
+					MorphTargetNamesHistory.Add(MorphTargetName, MorphTargetNames.Add(MorphTargetName));
+				}
 
-					MorphTargetIndex++;
-		}
-				PointsBase += Primitive.Positions.Num();
+				MorphTargetIndex++;
 			}
 
-			LOD.ImportData.MorphTargetModifiedPoints = MorphTargetModifiedPoints;
-			LOD.ImportData.MorphTargets = MorphTargetsData;
-			LOD.ImportData.MorphTargetNames = MorphTargetNames;
+			LOD.ImportData.MorphTargetModifiedPoints = MoveTemp(MorphTargetModifiedPoints);
+			LOD.ImportData.MorphTargets = MoveTemp(MorphTargetsData);
+			LOD.ImportData.MorphTargetNames = MoveTemp(MorphTargetNames);
 		}
 
 		ImportedResource->LODModels.Add(new FSkeletalMeshLODModel());
@@ -647,6 +748,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 	{
 		LOD.bHasTangents = true;
 		LOD.bHasNormals = true;
+		LOD.bHasUV = true;
 
 		FSkeletalMeshLODRenderData* LodRenderData = new FSkeletalMeshLODRenderData();
 		int32 LODIndex = SkeletalMeshContext->SkeletalMesh->GetResourceForRendering()->LODRenderData.Add(LodRenderData);
@@ -654,14 +756,108 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		LodRenderData->RenderSections.SetNumUninitialized(LOD.RuntimeLOD->Primitives.Num());
 
 		int32 NumIndices = 0;
+		TArray<uint32> MaxSourceVertexIndices;
+		MaxSourceVertexIndices.AddZeroed(LOD.RuntimeLOD->Primitives.Num());
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD.RuntimeLOD->Primitives.Num(); PrimitiveIndex++)
 		{
-			NumIndices += LOD.RuntimeLOD->Primitives[PrimitiveIndex].Indices.Num();
+			const FglTFRuntimePrimitive& Primitive = LOD.RuntimeLOD->Primitives[PrimitiveIndex];
+			NumIndices += Primitive.Indices.Num();
+			if (Primitive.Indices.Num() == 0)
+			{
+				continue;
+			}
+
+			uint32& MaxSourceVertexIndex = MaxSourceVertexIndices[PrimitiveIndex];
+			for (const uint32 VertexIndex : Primitive.Indices)
+			{
+				MaxSourceVertexIndex = FMath::Max(MaxSourceVertexIndex, VertexIndex);
+			}
+
+			if (MaxSourceVertexIndex >= static_cast<uint32>(Primitive.Positions.Num()))
+			{
+				AddError("CreateSkeletalMeshFromLODs()", FString::Printf(TEXT("Invalid vertex index %u (%d vertices)"), MaxSourceVertexIndex, Primitive.Positions.Num()));
+				return nullptr;
+			}
+
+			if (MaxSourceVertexIndex >= static_cast<uint32>(Primitive.Normals.Num()))
+			{
+				LOD.bHasNormals = false;
+			}
+
+			if (MaxSourceVertexIndex >= static_cast<uint32>(Primitive.Tangents.Num()))
+			{
+				LOD.bHasTangents = false;
+			}
+
+			if (Primitive.UVs.Num() == 0 || MaxSourceVertexIndex >= static_cast<uint32>(Primitive.UVs[0].Num()))
+			{
+				LOD.bHasUV = false;
+			}
+		}
+
+		if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always)
+		{
+			LOD.bHasNormals = false;
+		}
+		else if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Never)
+		{
+			LOD.bHasNormals = true;
+		}
+
+		if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always)
+		{
+			LOD.bHasTangents = false;
+		}
+		else if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Never)
+		{
+			LOD.bHasTangents = true;
+		}
+
+		// one render vertex for each unique source vertex of a section (in first use order), indices are remapped.
+		// Flat normals require a vertex for each index.
+		const bool bShareVertices = LOD.bHasNormals;
+
+		TArray<uint32> LODIndices;
+		LODIndices.Reserve(NumIndices);
+		LOD.SourceVertices.Reset(bShareVertices ? 0 : NumIndices);
+
+		TArray<int32> SectionsNumVertices;
+		TArray<int32> VertexRemap;
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD.RuntimeLOD->Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& Primitive = LOD.RuntimeLOD->Primitives[PrimitiveIndex];
+			const int32 SectionVertexBase = LOD.SourceVertices.Num();
+
+			if (!bShareVertices)
+			{
+				for (const uint32 VertexIndex : Primitive.Indices)
+				{
+					LODIndices.Add(LOD.SourceVertices.Add(VertexIndex));
+				}
+			}
+			else if (Primitive.Indices.Num() > 0)
+			{
+				VertexRemap.SetNumUninitialized(Primitive.Positions.Num(), false);
+				FMemory::Memset(VertexRemap.GetData(), 0xFF, VertexRemap.Num() * VertexRemap.GetTypeSize());
+
+				for (const uint32 VertexIndex : Primitive.Indices)
+				{
+					if (VertexRemap[VertexIndex] == INDEX_NONE)
+					{
+						VertexRemap[VertexIndex] = LOD.SourceVertices.Add(VertexIndex);
+					}
+					LODIndices.Add(VertexRemap[VertexIndex]);
+				}
+			}
+
+			SectionsNumVertices.Add(LOD.SourceVertices.Num() - SectionVertexBase);
 		}
 
-		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumIndices);
+		const int32 NumVertices = LOD.SourceVertices.Num();
+
+		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumVertices);
 		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionUVs);
-		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumIndices, 1);
+		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumVertices, 1);
 
 		int32 NumBones = RefSkeleton.GetNum();
 
@@ -672,11 +868,11 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		}
 
 		TArray<FSkinWeightInfo> InWeights;
-		InWeights.AddUninitialized(NumIndices);
+		InWeights.AddZeroed(NumVertices);
 
 		int32 TotalVertexIndex = 0;
-		int32 Base = 0;
-		int32 MaxBoneInfluences = 4;
+		int32 BaseIndex = 0;
+		int32 MaxBoneInfluences = 1;
 
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD.RuntimeLOD->Primitives.Num(); PrimitiveIndex++)
 		{
@@ -686,26 +882,22 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			FSkelMeshRenderSection& MeshSection = LodRenderData->RenderSections[PrimitiveIndex];
 
 			MeshSection.MaterialIndex = PrimitiveIndex;
-			MeshSection.BaseIndex = TotalVertexIndex;
+			MeshSection.BaseIndex = BaseIndex;
 			MeshSection.NumTriangles = Primitive.Indices.Num() / 3;
-			MeshSection.BaseVertexIndex = Base;
-			MeshSection.MaxBoneInfluences = FMath::Min(Primitive.Joints.Num() * 4, MAX_TOTAL_INFLUENCES);
-
-			if (MeshSection.MaxBoneInfluences > MaxBoneInfluences)
-			{
-				MaxBoneInfluences = MeshSection.MaxBoneInfluences;
-			}
+			MeshSection.BaseVertexIndex = TotalVertexIndex;
+			// grows with the influences actually kept by the vertices
+			MeshSection.MaxBoneInfluences = 1;
 
-			MeshSection.NumVertices = Primitive.Indices.Num();
+			MeshSection.NumVertices = SectionsNumVertices[PrimitiveIndex];
 
-			Base += MeshSection.NumVertices;
+			BaseIndex += Primitive.Indices.Num();
 
 			TMap<int32, TArray<int32>> OverlappingVertices;
 			MeshSection.DuplicatedVerticesBuffer.Init(MeshSection.NumVertices, OverlappingVertices);
 
-			for (int32 VertexIndex = 0; VertexIndex < Primitive.Indices.Num(); VertexIndex++)
+			for (int32 VertexIndex = 0; VertexIndex < MeshSection.NumVertices; VertexIndex++)
 			{
-				int32 Index = Primitive.Indices[VertexIndex];
+				int32 Index = LOD.SourceVertices[TotalVertexIndex];
 				FModelVertex ModelVertex;
 
 				float TangentXW = 1;
@@ -729,10 +921,6 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 					ModelVertex.TangentZ = Primitive.Normals[Index];
 #endif
 				}
-				else
-				{
-					LOD.bHasNormals = false;
-				}
 
 				if (Index < Primitive.Tangents.Num())
 				{
@@ -744,10 +932,6 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 #endif
 
 				}
-				else
-				{
-					LOD.bHasTangents = false;
-				}
 
 				if (Primitive.UVs.Num() > 0 && Index < Primitive.UVs[0].Num())
 				{
@@ -757,7 +941,6 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 #else
 					ModelVertex.TexCoord = Primitive.UVs[0][Index];
 #endif
-					LOD.bHasUV = true;
 				}
 				else
 				{
@@ -766,7 +949,6 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 #else
 					ModelVertex.TexCoord = FVector2D::ZeroVector;
 #endif
-					LOD.bHasUV = false;
 				}
 
 #if ENGINE_MAJOR_VERSION > 4
@@ -784,9 +966,8 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 				if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE)
 				{
-					uint32 TotalWeight = 0;
-					const int32 JoitsNum = FMath::Min(Primitive.Joints.Num(), MeshSection.MaxBoneInfluences / 4);
-					for (int32 JointsIndex = 0; JointsIndex < JoitsNum; JointsIndex++)
+					FglTFRuntimeBoneInfluences VertexInfluences;
+					for (int32 JointsIndex = 0; JointsIndex < Primitive.Joints.Num(); JointsIndex++)
 					{
 						FglTFRuntimeUInt16Vector4 Joints = Primitive.Joints[JointsIndex][Index];
 						FVector4 Weights = Primitive.Weights[JointsIndex][Index];
@@ -805,17 +986,10 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 									BonesCacheInUse.Add(Joints[j], BoneIndex);
 								}
 
-								BONE_INFLUENCE_TYPE QuantizedWeight = FMath::Clamp((BONE_INFLUENCE_TYPE)(Weights[j] * ((double)MAX_BONE_INFLUENCE_WEIGHT)), (BONE_INFLUENCE_TYPE)0x00, (BONE_INFLUENCE_TYPE)MAX_BONE_INFLUENCE_WEIGHT);
-
-								if (QuantizedWeight + TotalWeight > MAX_BONE_INFLUENCE_WEIGHT)
+								if (BoneIndex > INDEX_NONE)
 								{
-									QuantizedWeight = MAX_BONE_INFLUENCE_WEIGHT - TotalWeight;
+									VertexInfluences.Add({ BoneIndex, static_cast<float>(Weights[j]) });
 								}
-
-								InWeights[TotalVertexIndex].InfluenceWeights[JointsIndex * 4 + j] = QuantizedWeight;
-								InWeights[TotalVertexIndex].InfluenceBones[JointsIndex * 4 + j] = BoneIndex;
-
-								TotalWeight += QuantizedWeight;
 							}
 							else if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreMissingBones)
 							{
@@ -825,51 +999,56 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 						}
 					}
 
-					// fix weight
-					if (TotalWeight < MAX_BONE_INFLUENCE_WEIGHT)
+					glTFRuntimeCompactBoneInfluences(VertexInfluences, SkinMaxBoneInfluences, BoneInfluencesWeightThreshold);
+
+					if (VertexInfluences.Num() == 0)
 					{
-						InWeights[TotalVertexIndex].InfluenceWeights[0] += MAX_BONE_INFLUENCE_WEIGHT - TotalWeight;
+						VertexInfluences.Add({ 0, 1 });
 					}
+
+					// the rounding error goes to the heaviest influence, influences quantized to zero are dropped too
+					int32 TotalWeight = 0;
+					int32 NumVertexInfluences = 0;
+					for (const FglTFRuntimeBoneInfluence& VertexInfluence : VertexInfluences)
+					{
+						const int32 QuantizedWeight = FMath::Clamp(FMath::RoundToInt(VertexInfluence.Weight * MAX_BONE_INFLUENCE_WEIGHT), 0, MAX_BONE_INFLUENCE_WEIGHT);
+						if (QuantizedWeight == 0 && NumVertexInfluences > 0)
+						{
+							break;
+						}
+
+						InWeights[TotalVertexIndex].InfluenceWeights[NumVertexInfluences] = static_cast<BONE_INFLUENCE_TYPE>(QuantizedWeight);
+						InWeights[TotalVertexIndex].InfluenceBones[NumVertexInfluences] = VertexInfluence.BoneIndex;
+						TotalWeight += QuantizedWeight;
+						NumVertexInfluences++;
+					}
+
+					InWeights[TotalVertexIndex].InfluenceWeights[0] = static_cast<BONE_INFLUENCE_TYPE>(InWeights[TotalVertexIndex].InfluenceWeights[0] + MAX_BONE_INFLUENCE_WEIGHT - TotalWeight);
+
+					MeshSection.MaxBoneInfluences = FMath::Max(MeshSection.MaxBoneInfluences, NumVertexInfluences);
 				}
 				else
 				{
-					// reset it to be meaningful
-					MeshSection.MaxBoneInfluences = 1;
-					for (int32 j = 0; j < MeshSection.MaxBoneInfluences; j++)
-					{
-						InWeights[TotalVertexIndex].InfluenceWeights[j] = j == 0 ? MAX_BONE_INFLUENCE_WEIGHT : 0;
-						InWeights[TotalVertexIndex].InfluenceBones[j] = 0;
-					}
+					InWeights[TotalVertexIndex].InfluenceWeights[0] = MAX_BONE_INFLUENCE_WEIGHT;
+					InWeights[TotalVertexIndex].InfluenceBones[0] = 0;
 				}
 
 				TotalVertexIndex++;
 			}
 
+			if (MeshSection.MaxBoneInfluences > MaxBoneInfluences)
+			{
+				MaxBoneInfluences = MeshSection.MaxBoneInfluences;
+			}
+
 			for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex++)
 			{
 				MeshSection.BoneMap.Add(BoneIndex);
 			}
 		}
 
-		if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always)
-		{
-			LOD.bHasNormals = false;
-		}
-		else if (SkeletalMeshContext->SkeletalMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Never)
-		{
-			LOD.bHasNormals = true;
-		}
-
-		if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always)
-		{
-			LOD.bHasTangents = false;
-		}
-		else if (SkeletalMeshContext->SkeletalMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Never)
-		{
-			LOD.bHasTangents = true;
-		}
-
-		if ((!LOD.bHasTangents || !LOD.bHasNormals) && TotalVertexIndex % 3 == 0)
+		// without normals every index has its own vertex, so triangles are consecutive vertices
+		if (!LOD.bHasNormals && TotalVertexIndex % 3 == 0)
 		{
 
 			//normals with NaNs are incorrectly handled on Android
@@ -984,7 +1163,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 					LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex + 2, TangentX2, TangentY2, TangentZ2);
 #endif
 				}
-				else if (!LOD.bHasNormals) // if we are here we need to reapply normals
+				else // if we are here we need to reapply normals
 				{
 #if ENGINE_MAJOR_VERSION > 4
 					FVector4f TangentX0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(VertexIndex);
@@ -1010,13 +1189,85 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 				}
 			}
 		}
+		else if (!LOD.bHasTangents && LOD.bHasUV && NumIndices % 3 == 0)
+		{
+			// triangle tangents are accumulated on shared vertices
+			TArray<FVector> TangentsX;
+			TangentsX.AddZeroed(NumVertices);
+
+			for (int32 Index = 0; Index < NumIndices; Index += 3)
+			{
+				const uint32 Index0 = LODIndices[Index];
+				const uint32 Index1 = LODIndices[Index + 1];
+				const uint32 Index2 = LODIndices[Index + 2];
+
+#if ENGINE_MAJOR_VERSION > 4
+				const FVector Position0 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(Index0));
+				const FVector Position1 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(Index1));
+				const FVector Position2 = FVector(LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(Index2));
+				const FVector2D UV0 = FVector2D(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(Index0, 0));
+				const FVector2D UV1 = FVector2D(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(Index1, 0));
+				const FVector2D UV2 = FVector2D(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(Index2, 0));
+#else
+				const FVector Position0 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(Index0);
+				const FVector Position1 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(Index1);
+				const FVector Position2 = LodRenderData->StaticVertexBuffers.PositionVertexBuffer.VertexPosition(Index2);
+				const FVector2D UV0 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(Index0, 0);
+				const FVector2D UV1 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(Index1, 0);
+				const FVector2D UV2 = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(Index2, 0);
+#endif
+
+				const FVector DeltaPosition0 = Position1 - Position0;
+				const FVector DeltaPosition1 = Position2 - Position0;
+				const FVector2D DeltaUV0 = UV1 - UV0;
+				const FVector2D DeltaUV1 = UV2 - UV0;
+
+				const float Determinant = DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X;
+				// degenerate uvs would pollute the shared vertices
+				if (FMath::IsNearlyZero(Determinant))
+				{
+					continue;
+				}
+
+				const FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) / Determinant;
+
+				TangentsX[Index0] += TriangleTangentX;
+				TangentsX[Index1] += TriangleTangentX;
+				TangentsX[Index2] += TriangleTangentX;
+			}
+
+			for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+			{
+#if ENGINE_MAJOR_VERSION > 4
+				const FVector TangentZ = FVector(LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex));
+#else
+				const FVector TangentZ = LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(VertexIndex);
+#endif
+				FVector TangentX = TangentsX[VertexIndex] - (TangentZ * FVector::DotProduct(TangentZ, TangentsX[VertexIndex]));
+				if (!TangentX.Normalize())
+				{
+					continue;
+				}
+
+				const FVector TangentY = ComputeTangentY(TangentZ, TangentX) * TangentsDirection;
+#if ENGINE_MAJOR_VERSION > 4
+				LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, FVector3f(TangentX), FVector3f(TangentY), FVector3f(TangentZ));
+#else
+				LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertexIndex, TangentX, TangentY, TangentZ);
+#endif
+			}
+		}
 
 		LodRenderData->SkinWeightVertexBuffer.SetNeedsCPUAccess(SkeletalMeshContext->SkeletalMeshConfig.bPerPolyCollision);
-		LodRenderData->SkinWeightVertexBuffer.SetMaxBoneInfluences(MaxBoneInfluences);
+		// the smallest skin weights format (4, 8 or 12 influences, 8 or 16 bit bone indices) fitting the LOD
+		LodRenderData->SkinWeightVertexBuffer.SetMaxBoneInfluences(FMath::Min(Align(MaxBoneInfluences, 4), MAX_TOTAL_INFLUENCES));
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 24
+		LodRenderData->SkinWeightVertexBuffer.SetUse16BitBoneIndex(NumBones > MAX_uint8 + 1);
+#endif
 		LodRenderData->SkinWeightVertexBuffer = InWeights;
-		LodRenderData->MultiSizeIndexContainer.CreateIndexBuffer(sizeof(uint32_t));
+		LodRenderData->MultiSizeIndexContainer.CreateIndexBuffer(NumVertices <= MAX_uint16 + 1 ? sizeof(uint16) : sizeof(uint32_t));
 
-		for (int32 Index = 0; Index < NumIndices; Index++)
+		for (const uint32 Index : LODIndices)
 		{
 			LodRenderData->MultiSizeIndexContainer.GetIndexBuffer()->AddItem(Index);
 		}
@@ -1028,14 +1279,41 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
 {
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeSkeletalMeshWithLODs, FColor::Magenta);
+
+	while (!FinalizeSkeletalMeshStage(SkeletalMeshContext))
+	{
+	}
+
+	return SkeletalMeshContext->SkeletalMesh;
+}
+
+bool FglTFRuntimeParser::FinalizeSkeletalMeshStage(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext)
+{
+	if (!SkeletalMeshContext->SkeletalMesh || SkeletalMeshContext->FinalizeStage == EglTFRuntimeSkeletalMeshFinalizeStage::Completed)
+	{
+		return true;
+	}
+
+	switch (SkeletalMeshContext->FinalizeStage)
+	{
+	case EglTFRuntimeSkeletalMeshFinalizeStage::LODs:
+	{
+		// one LOD per stage
+		if (SkeletalMeshContext->FinalizeLODIndex >= SkeletalMeshContext->LODs.Num())
+		{
+			SkeletalMeshContext->FinalizeStage = EglTFRuntimeSkeletalMeshFinalizeStage::Skeleton;
+			return false;
+		}
 
+		FglTFRuntimeScopedStageStats StageStats(TEXT("SkeletalMesh.LOD"));
+
+		const int32 LODIndex = SkeletalMeshContext->FinalizeLODIndex++;
 #if !WITH_EDITOR
-	bool bHasMorphTargets = false;
-	int32 MorphTargetIndex = 0;
+		bool& bHasMorphTargets = SkeletalMeshContext->bHasMorphTargets;
+		int32& MorphTargetIndex = SkeletalMeshContext->MorphTargetIndex;
 #endif
 
-	for (int32 LODIndex = 0; LODIndex < SkeletalMeshContext->LODs.Num(); LODIndex++)
-	{
 #if WITH_EDITOR
 		SkeletalMeshContext->SkeletalMesh->SaveLODImportedData(LODIndex, SkeletalMeshContext->LODs[LODIndex].ImportData);
 #endif
@@ -1075,133 +1353,159 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 #if !WITH_EDITOR
 		TMap<FString, UMorphTarget*> MorphTargetNamesHistory;
 		TMap<FString, int32> MorphTargetNamesDuplicateCounter;
+		const float MorphTargetsDeltaThreshold = SkeletalMeshContext->SkeletalMeshConfig.MorphTargetsDeltaThreshold;
 
-		int32 BaseIndex = 0;
-
-		for (int32 PrimitiveIndex = 0; PrimitiveIndex < SkeletalMeshContext->LODs[LODIndex].RuntimeLOD->Primitives.Num(); PrimitiveIndex++)
+		struct FMorphTargetBuildJob
 		{
+			const FglTFRuntimeMorphTarget* MorphTargetData;
+			int32 PrimitiveIndex;
+			int32 BaseVertexIndex;
+			int32 NumVertices;
+			FMorphTargetLODModel MorphTargetLODModel;
+		};
+
+		const TArray<FglTFRuntimePrimitive>& Primitives = SkeletalMeshContext->LODs[LODIndex].RuntimeLOD->Primitives;
+		const TArray<uint32>& SourceVertices = SkeletalMeshContext->LODs[LODIndex].SourceVertices;
+		const FSkeletalMeshLODRenderData& LODRenderData = SkeletalMeshContext->SkeletalMesh->GetResourceForRendering()->LODRenderData[LODIndex];
 
-			FglTFRuntimePrimitive& Primitive = SkeletalMeshContext->LODs[LODIndex].RuntimeLOD->Primitives[PrimitiveIndex];
+		TArray<FMorphTargetBuildJob> MorphTargetJobs;
 
-			for (FglTFRuntimeMorphTarget& MorphTargetData : Primitive.MorphTargets)
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < Primitives.Num(); PrimitiveIndex++)
+		{
+			for (const FglTFRuntimeMorphTarget& MorphTargetData : Primitives[PrimitiveIndex].MorphTargets)
 			{
-				bool bSkip = true;
-				FMorphTargetLODModel MorphTargetLODModel;
-				MorphTargetLODModel.NumBaseMeshVerts = Primitive.Indices.Num();
-				MorphTargetLODModel.SectionIndices.Add(PrimitiveIndex);
+				FMorphTargetBuildJob& Job = MorphTargetJobs.AddDefaulted_GetRef();
+				Job.MorphTargetData = &MorphTargetData;
+				Job.PrimitiveIndex = PrimitiveIndex;
+				Job.BaseVertexIndex = LODRenderData.RenderSections[PrimitiveIndex].BaseVertexIndex;
+				Job.NumVertices = LODRenderData.RenderSections[PrimitiveIndex].NumVertices;
+			}
+		}
+
+		// every target is built independently, names and duplicates are resolved afterwards
+		ParallelFor(MorphTargetJobs.Num(), [&MorphTargetJobs, &SourceVertices, MorphTargetsDeltaThreshold](const int32 JobIndex)
+			{
+				FMorphTargetBuildJob& Job = MorphTargetJobs[JobIndex];
+				const TArray<FVector>& Positions = Job.MorphTargetData->Positions;
 
-				for (int32 Index = 0; Index < Primitive.Indices.Num(); Index++)
+				FMorphTargetLODModel& MorphTargetLODModel = Job.MorphTargetLODModel;
+				MorphTargetLODModel.NumBaseMeshVerts = Job.NumVertices;
+				MorphTargetLODModel.SectionIndices.Add(Job.PrimitiveIndex);
+
+				// only the non-zero deltas of the section render vertices are stored
+				auto HasDelta = [&Positions, MorphTargetsDeltaThreshold](const uint32 VertexIndex)
 				{
-					FMorphTargetDelta Delta;
-					int32 VertexIndex = Primitive.Indices[Index];
-					if (VertexIndex < MorphTargetData.Positions.Num())
-					{
-#if ENGINE_MAJOR_VERSION > 4
-						Delta.PositionDelta = FVector3f(MorphTargetData.Positions[VertexIndex]);
-#else
-						Delta.PositionDelta = MorphTargetData.Positions[VertexIndex];
-#endif
-					}
-					else
-					{
-#if ENGINE_MAJOR_VERSION > 4
-						Delta.PositionDelta = FVector3f::ZeroVector;
-#else
-						Delta.PositionDelta = FVector::ZeroVector;
-#endif
-					}
+					return VertexIndex < static_cast<uint32>(Positions.Num()) && !Positions[VertexIndex].IsNearlyZero(MorphTargetsDeltaThreshold);
+				};
+
+				int32 NumDeltas = 0;
+				for (int32 Index = Job.BaseVertexIndex; Index < Job.BaseVertexIndex + Job.NumVertices; Index++)
+				{
+					NumDeltas += HasDelta(SourceVertices[Index]) ? 1 : 0;
+				}
+
+				MorphTargetLODModel.Vertices.Reserve(NumDeltas);
 
-					if (!Delta.PositionDelta.IsNearlyZero())
+				for (int32 Index = Job.BaseVertexIndex; Index < Job.BaseVertexIndex + Job.NumVertices; Index++)
+				{
+					const uint32 VertexIndex = SourceVertices[Index];
+					if (!HasDelta(VertexIndex))
 					{
-						bSkip = false;
+						continue;
 					}
 
-					Delta.SourceIdx = BaseIndex + Index;
+					FMorphTargetDelta Delta;
 #if ENGINE_MAJOR_VERSION > 4
+					Delta.PositionDelta = FVector3f(Positions[VertexIndex]);
 					Delta.TangentZDelta = FVector3f::ZeroVector;
 #else
+					Delta.PositionDelta = Positions[VertexIndex];
 					Delta.TangentZDelta = FVector::ZeroVector;
 #endif
+					Delta.SourceIdx = Index;
 					MorphTargetLODModel.Vertices.Add(Delta);
+				}
 #if ENGINE_MAJOR_VERSION > 4
-					MorphTargetLODModel.NumVertices = MorphTargetLODModel.Vertices.Num();
+				MorphTargetLODModel.NumVertices = MorphTargetLODModel.Vertices.Num();
 #endif
-				}
+			});
 
-				if (SkeletalMeshContext->SkeletalMeshConfig.bIgnoreEmptyMorphTargets && bSkip)
-				{
-					continue;
-				}
+		for (FMorphTargetBuildJob& Job : MorphTargetJobs)
+		{
+			FMorphTargetLODModel& MorphTargetLODModel = Job.MorphTargetLODModel;
 
-				FString MorphTargetName = MorphTargetData.Name;
-				if (MorphTargetName.IsEmpty())
+			if (SkeletalMeshContext->SkeletalMeshConfig.bIgnoreEmptyMorphTargets && MorphTargetLODModel.Vertices.Num() == 0)
+			{
+				continue;
+			}
+
+			FString MorphTargetName = Job.MorphTargetData->Name;
+			if (MorphTargetName.IsEmpty())
+			{
+				MorphTargetName = FString::Printf(TEXT("MorphTarget_%d"), MorphTargetIndex);
+			}
+
+			bool bAddMorphTarget = false;
+			if (MorphTargetNamesHistory.Contains(MorphTargetName))
+			{
+				UMorphTarget* CurrentMorphTarget = MorphTargetNamesHistory[MorphTargetName];
+				EglTFRuntimeMorphTargetsDuplicateStrategy DuplicateStrategy = SkeletalMeshContext->SkeletalMeshConfig.MorphTargetsDuplicateStrategy;
+				if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Ignore)
 				{
-					MorphTargetName = FString::Printf(TEXT("MorphTarget_%d"), MorphTargetIndex);
+					// NOP
 				}
-
-				bool bAddMorphTarget = false;
-				if (MorphTargetNamesHistory.Contains(MorphTargetName))
+				else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Merge)
 				{
-					UMorphTarget* CurrentMorphTarget = MorphTargetNamesHistory[MorphTargetName];
-					EglTFRuntimeMorphTargetsDuplicateStrategy DuplicateStrategy = SkeletalMeshContext->SkeletalMeshConfig.MorphTargetsDuplicateStrategy;
-					if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Ignore)
-					{
-						// NOP
-					}
-					else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::Merge)
-					{
 #if ENGINE_MAJOR_VERSION > 4
-						CurrentMorphTarget->GetMorphLODModels()[0].NumBaseMeshVerts += MorphTargetLODModel.NumBaseMeshVerts;
-						CurrentMorphTarget->GetMorphLODModels()[0].SectionIndices.Append(MorphTargetLODModel.SectionIndices);
-						CurrentMorphTarget->GetMorphLODModels()[0].Vertices.Append(MorphTargetLODModel.Vertices);
-						CurrentMorphTarget->GetMorphLODModels()[0].NumVertices = CurrentMorphTarget->GetMorphLODModels()[0].Vertices.Num();
+					CurrentMorphTarget->GetMorphLODModels()[0].NumBaseMeshVerts += MorphTargetLODModel.NumBaseMeshVerts;
+					CurrentMorphTarget->GetMorphLODModels()[0].SectionIndices.Append(MorphTargetLODModel.SectionIndices);
+					CurrentMorphTarget->GetMorphLODModels()[0].Vertices.Append(MorphTargetLODModel.Vertices);
+					CurrentMorphTarget->GetMorphLODModels()[0].NumVertices = CurrentMorphTarget->GetMorphLODModels()[0].Vertices.Num();
 #else
-						CurrentMorphTarget->MorphLODModels[0].NumBaseMeshVerts += MorphTargetLODModel.NumBaseMeshVerts;
-						CurrentMorphTarget->MorphLODModels[0].SectionIndices.Append(MorphTargetLODModel.SectionIndices);
-						CurrentMorphTarget->MorphLODModels[0].Vertices.Append(MorphTargetLODModel.Vertices);
+					CurrentMorphTarget->MorphLODModels[0].NumBaseMeshVerts += MorphTargetLODModel.NumBaseMeshVerts;
+					CurrentMorphTarget->MorphLODModels[0].SectionIndices.Append(MorphTargetLODModel.SectionIndices);
+					CurrentMorphTarget->MorphLODModels[0].Vertices.Append(MorphTargetLODModel.Vertices);
 #endif
-					}
-					else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendDuplicateCounter)
+				}
+				else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendDuplicateCounter)
+				{
+					if (MorphTargetNamesDuplicateCounter.Contains(MorphTargetName))
 					{
-						if (MorphTargetNamesDuplicateCounter.Contains(MorphTargetName))
-						{
-							MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetNamesDuplicateCounter[MorphTargetName] + 1);
-							MorphTargetNamesDuplicateCounter[MorphTargetName] += 1;
-						}
-						else
-						{
-							MorphTargetName = FString::Printf(TEXT("%s_1"), *MorphTargetName);
-							MorphTargetNamesDuplicateCounter.Add(MorphTargetName, 1);
-						}
-						bAddMorphTarget = true;
+						MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetNamesDuplicateCounter[MorphTargetName] + 1);
+						MorphTargetNamesDuplicateCounter[MorphTargetName] += 1;
 					}
-					else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendMorphIndex)
+					else
 					{
-						MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetIndex);
-						bAddMorphTarget = true;
+						MorphTargetName = FString::Printf(TEXT("%s_1"), *MorphTargetName);
+						MorphTargetNamesDuplicateCounter.Add(MorphTargetName, 1);
 					}
+					bAddMorphTarget = true;
 				}
-				else
+				else if (DuplicateStrategy == EglTFRuntimeMorphTargetsDuplicateStrategy::AppendMorphIndex)
 				{
+					MorphTargetName = FString::Printf(TEXT("%s_%d"), *MorphTargetName, MorphTargetIndex);
 					bAddMorphTarget = true;
 				}
+			}
+			else
+			{
+				bAddMorphTarget = true;
+			}
 
-				if (bAddMorphTarget)
-				{
-					UMorphTarget* MorphTarget = NewObject<UMorphTarget>(SkeletalMeshContext->SkeletalMesh, *MorphTargetName, RF_Public);
+			if (bAddMorphTarget)
+			{
+				UMorphTarget* MorphTarget = NewObject<UMorphTarget>(SkeletalMeshContext->SkeletalMesh, *MorphTargetName, RF_Public);
 #if ENGINE_MAJOR_VERSION > 4
-					MorphTarget->GetMorphLODModels().Add(MorphTargetLODModel);
+				MorphTarget->GetMorphLODModels().Add(MoveTemp(MorphTargetLODModel));
 #else
-					MorphTarget->MorphLODModels.Add(MorphTargetLODModel);
+				MorphTarget->MorphLODModels.Add(MoveTemp(MorphTargetLODModel));
 #endif
-					SkeletalMeshContext->SkeletalMesh->RegisterMorphTarget(MorphTarget, false);
-					MorphTargetNamesHistory.Add(MorphTargetName, MorphTarget);
-					bHasMorphTargets = true;
-				}
-
-				MorphTargetIndex++;
+				SkeletalMeshContext->SkeletalMesh->RegisterMorphTarget(MorphTarget, false);
+				MorphTargetNamesHistory.Add(MorphTargetName, MorphTarget);
+				bHasMorphTargets = true;
 			}
-			BaseIndex += Primitive.Indices.Num();
+
+			MorphTargetIndex++;
 		}
 
 #endif
@@ -1231,226 +1535,251 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 		if (!MeshBuilderModule.BuildSkeletalMesh(SkeletalMeshContext->SkeletalMesh, LODIndex, false))
 #endif
 		{
-			return nullptr;
+			SkeletalMeshContext->SkeletalMesh = nullptr;
+			return true;
 		}
 #endif
+		return false;
 	}
+	case EglTFRuntimeSkeletalMeshFinalizeStage::Skeleton:
+	{
+		FglTFRuntimeScopedStageStats StageStats(TEXT("SkeletalMesh.Skeleton"));
 
 #if WITH_EDITOR
-	SkeletalMeshContext->SkeletalMesh->Build();
+		SkeletalMeshContext->SkeletalMesh->Build();
 #endif
-	SkeletalMeshContext->SkeletalMesh->CalculateInvRefMatrices();
+		SkeletalMeshContext->SkeletalMesh->CalculateInvRefMatrices();
 
-	if (SkeletalMeshContext->SkeletalMeshConfig.bShiftBoundsByRootBone)
-	{
+		if (SkeletalMeshContext->SkeletalMeshConfig.bShiftBoundsByRootBone)
+		{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-		FVector RootBone = SkeletalMeshContext->SkeletalMesh->GetRefSkeleton().GetRefBonePose()[0].GetLocation();
+			FVector RootBone = SkeletalMeshContext->SkeletalMesh->GetRefSkeleton().GetRefBonePose()[0].GetLocation();
 #else
-		FVector RootBone = SkeletalMeshContext->SkeletalMesh->RefSkeleton.GetRefBonePose()[0].GetLocation();
+			FVector RootBone = SkeletalMeshContext->SkeletalMesh->RefSkeleton.GetRefBonePose()[0].GetLocation();
 #endif
-		SkeletalMeshContext->BoundingBox = SkeletalMeshContext->BoundingBox.ShiftBy(RootBone);
-	}
+			SkeletalMeshContext->BoundingBox = SkeletalMeshContext->BoundingBox.ShiftBy(RootBone);
+		}
 
-	SkeletalMeshContext->BoundingBox = SkeletalMeshContext->BoundingBox.ShiftBy(SkeletalMeshContext->SkeletalMeshConfig.ShiftBounds);
+		SkeletalMeshContext->BoundingBox = SkeletalMeshContext->BoundingBox.ShiftBy(SkeletalMeshContext->SkeletalMeshConfig.ShiftBounds);
 
-	SkeletalMeshContext->SkeletalMesh->SetImportedBounds(FBoxSphereBounds(SkeletalMeshContext->BoundingBox));
+		SkeletalMeshContext->SkeletalMesh->SetImportedBounds(FBoxSphereBounds(SkeletalMeshContext->BoundingBox));
 
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-	SkeletalMeshContext->SkeletalMesh->SetHasVertexColors(false);
+		SkeletalMeshContext->SkeletalMesh->SetHasVertexColors(false);
 #else
-	SkeletalMeshContext->SkeletalMesh->bHasVertexColors = false;
+		SkeletalMeshContext->SkeletalMesh->bHasVertexColors = false;
 #endif
 
 #if WITH_EDITOR
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-	SkeletalMeshContext->SkeletalMesh->SetVertexColorGuid(SkeletalMeshContext->SkeletalMesh->GetHasVertexColors() ? FGuid::NewGuid() : FGuid());
+		SkeletalMeshContext->SkeletalMesh->SetVertexColorGuid(SkeletalMeshContext->SkeletalMesh->GetHasVertexColors() ? FGuid::NewGuid() : FGuid());
 #else
-	SkeletalMeshContext->SkeletalMesh->VertexColorGuid = SkeletalMeshContext->SkeletalMesh->bHasVertexColors ? FGuid::NewGuid() : FGuid();
+		SkeletalMeshContext->SkeletalMesh->VertexColorGuid = SkeletalMeshContext->SkeletalMesh->bHasVertexColors ? FGuid::NewGuid() : FGuid();
 #endif
 #endif
 
-	if (SkeletalMeshContext->SkeletalMeshConfig.Skeleton)
-	{
+		if (SkeletalMeshContext->SkeletalMeshConfig.Skeleton)
+		{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-		SkeletalMeshContext->SkeletalMesh->SetSkeleton(SkeletalMeshContext->SkeletalMeshConfig.Skeleton);
+			SkeletalMeshContext->SkeletalMesh->SetSkeleton(SkeletalMeshContext->SkeletalMeshConfig.Skeleton);
 #else
-		SkeletalMeshContext->SkeletalMesh->Skeleton = SkeletalMeshContext->SkeletalMeshConfig.Skeleton;
+			SkeletalMeshContext->SkeletalMesh->Skeleton = SkeletalMeshContext->SkeletalMeshConfig.Skeleton;
 #endif
-		if (SkeletalMeshContext->SkeletalMeshConfig.bMergeAllBonesToBoneTree)
-		{
+			if (SkeletalMeshContext->SkeletalMeshConfig.bMergeAllBonesToBoneTree)
+			{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->GetSkeleton()->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
+				SkeletalMeshContext->SkeletalMesh->GetSkeleton()->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
 #else
-			SkeletalMeshContext->SkeletalMesh->Skeleton->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
+				SkeletalMeshContext->SkeletalMesh->Skeleton->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
 #endif
+			}
 		}
-	}
-	else
-	{
-		if (CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletonsCache.Contains(SkeletalMeshContext->SkinIndex))
+		else
 		{
+			if (CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletonsCache.Contains(SkeletalMeshContext->SkinIndex))
+			{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->SetSkeleton(SkeletonsCache[SkeletalMeshContext->SkinIndex]);
+				SkeletalMeshContext->SkeletalMesh->SetSkeleton(SkeletonsCache[SkeletalMeshContext->SkinIndex]);
 #else
-			SkeletalMeshContext->SkeletalMesh->Skeleton = SkeletonsCache[SkeletalMeshContext->SkinIndex];
+				SkeletalMeshContext->SkeletalMesh->Skeleton = SkeletonsCache[SkeletalMeshContext->SkinIndex];
 #endif
-		}
-		else
-		{
+			}
+			else
+			{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->SetSkeleton(NewObject<USkeleton>(GetTransientPackage(), NAME_None, RF_Public));
-			SkeletalMeshContext->SkeletalMesh->GetSkeleton()->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
+				SkeletalMeshContext->SkeletalMesh->SetSkeleton(NewObject<USkeleton>(GetTransientPackage(), NAME_None, RF_Public));
+				SkeletalMeshContext->SkeletalMesh->GetSkeleton()->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
 #else
-			SkeletalMeshContext->SkeletalMesh->Skeleton = NewObject<USkeleton>(GetTransientPackage(), NAME_None, RF_Public);
-			SkeletalMeshContext->SkeletalMesh->Skeleton->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
+				SkeletalMeshContext->SkeletalMesh->Skeleton = NewObject<USkeleton>(GetTransientPackage(), NAME_None, RF_Public);
+				SkeletalMeshContext->SkeletalMesh->Skeleton->MergeAllBonesToBoneTree(SkeletalMeshContext->SkeletalMesh);
 #endif
 
-			if (CanWriteToCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode))
-			{
+				if (CanWriteToCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode))
+				{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-				SkeletonsCache.Add(SkeletalMeshContext->SkinIndex, SkeletalMeshContext->SkeletalMesh->GetSkeleton());
+					SkeletonsCache.Add(SkeletalMeshContext->SkinIndex, SkeletalMeshContext->SkeletalMesh->GetSkeleton());
 #else
-				SkeletonsCache.Add(SkeletalMeshContext->SkinIndex, SkeletalMeshContext->SkeletalMesh->Skeleton);
+					SkeletonsCache.Add(SkeletalMeshContext->SkinIndex, SkeletalMeshContext->SkeletalMesh->Skeleton);
 #endif
-			}
+				}
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->GetSkeleton()->SetPreviewMesh(SkeletalMeshContext->SkeletalMesh);
+				SkeletalMeshContext->SkeletalMesh->GetSkeleton()->SetPreviewMesh(SkeletalMeshContext->SkeletalMesh);
 #else
-			SkeletalMeshContext->SkeletalMesh->Skeleton->SetPreviewMesh(SkeletalMeshContext->SkeletalMesh);
+				SkeletalMeshContext->SkeletalMesh->Skeleton->SetPreviewMesh(SkeletalMeshContext->SkeletalMesh);
 #endif
-		}
+			}
 
-		for (const TPair<FString, FglTFRuntimeSocket>& Pair : SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.Sockets)
-		{
+			for (const TPair<FString, FglTFRuntimeSocket>& Pair : SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.Sockets)
+			{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			USkeletalMeshSocket* SkeletalSocket = NewObject<USkeletalMeshSocket>(SkeletalMeshContext->SkeletalMesh->GetSkeleton());
+				USkeletalMeshSocket* SkeletalSocket = NewObject<USkeletalMeshSocket>(SkeletalMeshContext->SkeletalMesh->GetSkeleton());
 #else
-			USkeletalMeshSocket* SkeletalSocket = NewObject<USkeletalMeshSocket>(SkeletalMeshContext->SkeletalMesh->Skeleton);
+				USkeletalMeshSocket* SkeletalSocket = NewObject<USkeletalMeshSocket>(SkeletalMeshContext->SkeletalMesh->Skeleton);
 #endif
-			SkeletalSocket->SocketName = FName(Pair.Key);
-			SkeletalSocket->BoneName = FName(Pair.Value.BoneName);
-			SkeletalSocket->RelativeLocation = Pair.Value.Transform.GetLocation();
-			SkeletalSocket->RelativeRotation = Pair.Value.Transform.GetRotation().Rotator();
-			SkeletalSocket->RelativeScale = Pair.Value.Transform.GetScale3D();
+				SkeletalSocket->SocketName = FName(Pair.Key);
+				SkeletalSocket->BoneName = FName(Pair.Value.BoneName);
+				SkeletalSocket->RelativeLocation = Pair.Value.Transform.GetLocation();
+				SkeletalSocket->RelativeRotation = Pair.Value.Transform.GetRotation().Rotator();
+				SkeletalSocket->RelativeScale = Pair.Value.Transform.GetScale3D();
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->GetSkeleton()->Sockets.Add(SkeletalSocket);
+				SkeletalMeshContext->SkeletalMesh->GetSkeleton()->Sockets.Add(SkeletalSocket);
 #else
-			SkeletalMeshContext->SkeletalMesh->Skeleton->Sockets.Add(SkeletalSocket);
+				SkeletalMeshContext->SkeletalMesh->Skeleton->Sockets.Add(SkeletalSocket);
 #endif
+			}
 		}
+
+		SkeletalMeshContext->FinalizeStage = EglTFRuntimeSkeletalMeshFinalizeStage::Physics;
+		return false;
 	}
+	case EglTFRuntimeSkeletalMeshFinalizeStage::Physics:
+	{
+		FglTFRuntimeScopedStageStats StageStats(TEXT("SkeletalMesh.Physics"));
 
 #if !WITH_EDITOR
-	if (bHasMorphTargets)
-	{
-		SkeletalMeshContext->SkeletalMesh->InitMorphTargets();
-	}
+		if (SkeletalMeshContext->bHasMorphTargets)
+		{
+			SkeletalMeshContext->SkeletalMesh->InitMorphTargets();
+		}
 #endif
 
-	if (SkeletalMeshContext->SkeletalMeshConfig.PhysicsBodies.Num() > 0 || SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetTemplate)
-	{
-		UPhysicsAsset* PhysicsAsset = NewObject<UPhysicsAsset>(SkeletalMeshContext->SkeletalMesh, NAME_None, RF_Public);
-		if (PhysicsAsset)
+		if (SkeletalMeshContext->SkeletalMeshConfig.PhysicsBodies.Num() > 0 || SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetTemplate)
 		{
-			if (SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetTemplate)
+			UPhysicsAsset* PhysicsAsset = NewObject<UPhysicsAsset>(SkeletalMeshContext->SkeletalMesh, NAME_None, RF_Public);
+			if (PhysicsAsset)
 			{
-				UPhysicsAsset* PhysicsAssetTemplate = SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetTemplate;
-				for (USkeletalBodySetup* SourceBodySetup : PhysicsAssetTemplate->SkeletalBodySetups)
+				if (SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetTemplate)
 				{
+					UPhysicsAsset* PhysicsAssetTemplate = SkeletalMeshContext->SkeletalMeshConfig.PhysicsAssetTemplate;
+					for (USkeletalBodySetup* SourceBodySetup : PhysicsAssetTemplate->SkeletalBodySetups)
+					{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-					if (SkeletalMeshContext->SkeletalMesh->GetSkeleton()->GetReferenceSkeleton().FindBoneIndex(SourceBodySetup->BoneName) != INDEX_NONE)
+						if (SkeletalMeshContext->SkeletalMesh->GetSkeleton()->GetReferenceSkeleton().FindBoneIndex(SourceBodySetup->BoneName) != INDEX_NONE)
 #else
-					if (SkeletalMeshContext->SkeletalMesh->Skeleton->GetReferenceSkeleton().FindBoneIndex(SourceBodySetup->BoneName) != INDEX_NONE)
+						if (SkeletalMeshContext->SkeletalMesh->Skeleton->GetReferenceSkeleton().FindBoneIndex(SourceBodySetup->BoneName) != INDEX_NONE)
 #endif
+						{
+							USkeletalBodySetup* NewBodySetup = NewObject<USkeletalBodySetup>(PhysicsAsset, NAME_None, RF_Public);
+							NewBodySetup->CollisionTraceFlag = SourceBodySetup->CollisionTraceFlag;
+							NewBodySetup->PhysicsType = SourceBodySetup->PhysicsType;
+							NewBodySetup->BoneName = SourceBodySetup->BoneName;
+							NewBodySetup->bConsiderForBounds = SourceBodySetup->bConsiderForBounds;
+							NewBodySetup->AggGeom = SourceBodySetup->AggGeom;
+							PhysicsAsset->SkeletalBodySetups.Add(NewBodySetup);
+						}
+					}
+					for (UPhysicsConstraintTemplate* ConstraintTemplate : PhysicsAssetTemplate->ConstraintSetup)
 					{
-						USkeletalBodySetup* NewBodySetup = NewObject<USkeletalBodySetup>(PhysicsAsset, NAME_None, RF_Public);
-						NewBodySetup->CollisionTraceFlag = SourceBodySetup->CollisionTraceFlag;
-						NewBodySetup->PhysicsType = SourceBodySetup->PhysicsType;
-						NewBodySetup->BoneName = SourceBodySetup->BoneName;
-						NewBodySetup->bConsiderForBounds = SourceBodySetup->bConsiderForBounds;
-						NewBodySetup->AggGeom = SourceBodySetup->AggGeom;
-						PhysicsAsset->SkeletalBodySetups.Add(NewBodySetup);
+						UPhysicsConstraintTemplate* NewConstraint = NewObject<UPhysicsConstraintTemplate>(PhysicsAsset, NAME_None, RF_Public);
+						NewConstraint->DefaultInstance = ConstraintTemplate->DefaultInstance;
+						NewConstraint->ProfileHandles = ConstraintTemplate->ProfileHandles;
+						PhysicsAsset->ConstraintSetup.Add(NewConstraint);
 					}
 				}
-				for (UPhysicsConstraintTemplate* ConstraintTemplate : PhysicsAssetTemplate->ConstraintSetup)
-				{
-					UPhysicsConstraintTemplate* NewConstraint = NewObject<UPhysicsConstraintTemplate>(PhysicsAsset, NAME_None, RF_Public);
-					NewConstraint->DefaultInstance = ConstraintTemplate->DefaultInstance;
-					NewConstraint->ProfileHandles = ConstraintTemplate->ProfileHandles;
-					PhysicsAsset->ConstraintSetup.Add(NewConstraint);
-				}
-			}
-			for (const TPair<FString, FglTFRuntimePhysicsBody>& PhysicsBody : SkeletalMeshContext->SkeletalMeshConfig.PhysicsBodies)
-			{
-				if (PhysicsBody.Key.IsEmpty())
+				for (const TPair<FString, FglTFRuntimePhysicsBody>& PhysicsBody : SkeletalMeshContext->SkeletalMeshConfig.PhysicsBodies)
 				{
-					continue;
-				}
-				USkeletalBodySetup* NewBodySetup = NewObject<USkeletalBodySetup>(PhysicsAsset, NAME_None, RF_Public);
-				NewBodySetup->CollisionTraceFlag = PhysicsBody.Value.CollisionTraceFlag;
-				NewBodySetup->PhysicsType = PhysicsBody.Value.PhysicsType;
-				NewBodySetup->BoneName = FName(PhysicsBody.Key);
-				NewBodySetup->bConsiderForBounds = PhysicsBody.Value.bConsiderForBounds;
+					if (PhysicsBody.Key.IsEmpty())
+					{
+						continue;
+					}
+					USkeletalBodySetup* NewBodySetup = NewObject<USkeletalBodySetup>(PhysicsAsset, NAME_None, RF_Public);
+					NewBodySetup->CollisionTraceFlag = PhysicsBody.Value.CollisionTraceFlag;
+					NewBodySetup->PhysicsType = PhysicsBody.Value.PhysicsType;
+					NewBodySetup->BoneName = FName(PhysicsBody.Key);
+					NewBodySetup->bConsiderForBounds = PhysicsBody.Value.bConsiderForBounds;
 
-				for (const FglTFRuntimeCapsule& CapsuleCollision : PhysicsBody.Value.CapsuleCollisions)
-				{
-					FKSphylElem Capsule;
-					Capsule.Length = CapsuleCollision.Length;
-					Capsule.Center = CapsuleCollision.Center;
-					Capsule.Radius = CapsuleCollision.Radius;
-					Capsule.Rotation = CapsuleCollision.Rotation;
-					NewBodySetup->AggGeom.SphylElems.Add(Capsule);
-				}
+					for (const FglTFRuntimeCapsule& CapsuleCollision : PhysicsBody.Value.CapsuleCollisions)
+					{
+						FKSphylElem Capsule;
+						Capsule.Length = CapsuleCollision.Length;
+						Capsule.Center = CapsuleCollision.Center;
+						Capsule.Radius = CapsuleCollision.Radius;
+						Capsule.Rotation = CapsuleCollision.Rotation;
+						NewBodySetup->AggGeom.SphylElems.Add(Capsule);
+					}
 
-				PhysicsAsset->SkeletalBodySetups.Add(NewBodySetup);
-			}
+					PhysicsAsset->SkeletalBodySetups.Add(NewBodySetup);
+				}
 
-			PhysicsAsset->UpdateBodySetupIndexMap();
-			PhysicsAsset->UpdateBoundsBodiesArray();
+				PhysicsAsset->UpdateBodySetupIndexMap();
+				PhysicsAsset->UpdateBoundsBodiesArray();
 #if WITH_EDITOR
-			PhysicsAsset->PreviewSkeletalMesh = SkeletalMeshContext->SkeletalMesh;
+				PhysicsAsset->PreviewSkeletalMesh = SkeletalMeshContext->SkeletalMesh;
 #endif
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
-			SkeletalMeshContext->SkeletalMesh->SetPhysicsAsset(PhysicsAsset);
+				SkeletalMeshContext->SkeletalMesh->SetPhysicsAsset(PhysicsAsset);
 #else
-			SkeletalMeshContext->SkeletalMesh->PhysicsAsset = PhysicsAsset;
+				SkeletalMeshContext->SkeletalMesh->PhysicsAsset = PhysicsAsset;
 #endif
+			}
 		}
+
+		SkeletalMeshContext->FinalizeStage = EglTFRuntimeSkeletalMeshFinalizeStage::PostLoad;
+		return false;
 	}
+	case EglTFRuntimeSkeletalMeshFinalizeStage::PostLoad:
+	{
+		FglTFRuntimeScopedStageStats StageStats(TEXT("SkeletalMesh.PostLoad"));
 
 #if !WITH_EDITOR
-	SkeletalMeshContext->SkeletalMesh->PostLoad();
+		SkeletalMeshContext->SkeletalMesh->PostLoad();
 #endif
 
-	if (OnSkeletalMeshCreated.IsBound())
-	{
-		OnSkeletalMeshCreated.Broadcast(SkeletalMeshContext->SkeletalMesh);
-	}
+		if (OnSkeletalMeshCreated.IsBound())
+		{
+			OnSkeletalMeshCreated.Broadcast(SkeletalMeshContext->SkeletalMesh);
+		}
 
 #if WITH_EDITOR
-	if (!SkeletalMeshContext->SkeletalMeshConfig.SaveToPackage.IsEmpty())
-	{
-		UPackage* Package = Cast<UPackage>(SkeletalMeshContext->SkeletalMesh->GetOuter());
-		if (Package && Package != GetTransientPackage())
+		if (!SkeletalMeshContext->SkeletalMeshConfig.SaveToPackage.IsEmpty())
 		{
-			const FString Filename = FPackageName::LongPackageNameToFilename(SkeletalMeshContext->SkeletalMeshConfig.SaveToPackage, FPackageName::GetAssetPackageExtension());
+			UPackage* Package = Cast<UPackage>(SkeletalMeshContext->SkeletalMesh->GetOuter());
+			if (Package && Package != GetTransientPackage())
+			{
+				const FString Filename = FPackageName::LongPackageNameToFilename(SkeletalMeshContext->SkeletalMeshConfig.SaveToPackage, FPackageName::GetAssetPackageExtension());
 #if ENGINE_MAJOR_VERSION > 4
-			FSavePackageArgs SavePackageArgs;
-			SavePackageArgs.TopLevelFlags = EObjectFlags::RF_Public | EObjectFlags::RF_Standalone;
-			if (UPackage::SavePackage(Package, nullptr, *Filename, SavePackageArgs))
+				FSavePackageArgs SavePackageArgs;
+				SavePackageArgs.TopLevelFlags = EObjectFlags::RF_Public | EObjectFlags::RF_Standalone;
+				if (UPackage::SavePackage(Package, nullptr, *Filename, SavePackageArgs))
 #else
-			if (UPackage::SavePackage(Package, nullptr, EObjectFlags::RF_Public | EObjectFlags::RF_Standalone, *Filename))
+				if (UPackage::SavePackage(Package, nullptr, EObjectFlags::RF_Public | EObjectFlags::RF_Standalone, *Filename))
 #endif
-			{
-				FAssetRegistryModule::AssetCreated(SkeletalMeshContext->SkeletalMesh);
+				{
+					FAssetRegistryModule::AssetCreated(SkeletalMeshContext->SkeletalMesh);
+				}
 			}
-	}
 		}
 #endif
 
-
-	return SkeletalMeshContext->SkeletalMesh;
+		SkeletalMeshContext->FinalizeStage = EglTFRuntimeSkeletalMeshFinalizeStage::Completed;
+		break;
 	}
+	default:
+		break;
+	}
+
+	return true;
+}
 
 USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig & SkeletalMeshConfig)
 {
@@ -1461,7 +1790,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const
 		return SkeletalMeshesCache[MeshIndex];
 	}
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		AddError("LoadSkeletalMesh()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -1504,11 +1833,11 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Get().Enqueue(AsyncTasksOwnerId, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		AddError("LoadSkeletalMeshAsync()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -1524,6 +1853,9 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 	SkeletalMeshContext->LODs.Add(LOD);
 
 	SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+		}, [AsyncCallback]()
+		{
+			FglTFRuntimeGameThreadQueue::Get().Enqueue([AsyncCallback]() { AsyncCallback.ExecuteIfBound(nullptr); });
 		});
 }
 
@@ -1534,7 +1866,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshLODs(const TArray<int32>&Mesh
 
 	for (const int32 MeshIndex : MeshIndices)
 	{
-		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 		if (!JsonMeshObject)
 		{
 			AddError("LoadSkeletalMesh()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -1584,7 +1916,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString & NodeName
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), SkeletalMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Get().Enqueue(AsyncTasksOwnerId, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 	// ensure to cache it as the finalizer requires LOD access
@@ -1599,6 +1931,9 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString & NodeName
 	SkeletalMeshContext->LODs.Add(&CombinedLOD);
 
 	SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
+		}, [AsyncCallback]()
+		{
+			FglTFRuntimeGameThreadQueue::Get().Enqueue([AsyncCallback]() { AsyncCallback.ExecuteIfBound(nullptr); });
 		});
 }
 
@@ -1656,7 +1991,7 @@ UAnimSequence* FglTFRuntimeParser::LoadNodeSkeletalAnimation(USkeletalMesh * Ske
 	// this could be a static mesh read as a skeletal one...
 	if (Node.SkinIndex > INDEX_NONE)
 	{
-		TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex("skins", Node.SkinIndex);
+		TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Skins, Node.SkinIndex);
 		if (!JsonSkinObject)
 		{
 			AddError("LoadNodeSkeletalAnimation()", "No skins defined in the asset");
@@ -1728,7 +2063,7 @@ UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimation(USkeletalMesh * Skeleta
 		return nullptr;
 	}
 
-	TSharedPtr<FJsonObject> JsonAnimationObject = GetJsonObjectFromRootIndex("animations", AnimationIndex);
+	TSharedPtr<FJsonObject> JsonAnimationObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Animations, AnimationIndex);
 	if (!JsonAnimationObject)
 	{
 		AddError("LoadNodeSkeletalAnimation()", FString::Printf(TEXT("Unable to find animation %d"), AnimationIndex));
@@ -2132,6 +2467,7 @@ UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimation(USkeletalMesh * Skeleta
 #if ENGINE_MAJOR_VERSION > 4
 	AnimSequence->CompressedData.CompressedDataStructure->CompressedNumberOfKeys = NumFrames;
 #endif
+	CompressionCodec->BuildPoseTracks();
 	AnimSequence->CompressedData.BoneCompressionCodec = CompressionCodec;
 	UglTFAnimCurveCompressionCodec* AnimCurveCompressionCodec = NewObject<UglTFAnimCurveCompressionCodec>();
 	AnimCurveCompressionCodec->AnimSequence = AnimSequence;
@@ -2225,7 +2561,7 @@ UAnimSequence* FglTFRuntimeParser::CreateAnimationFromPose(USkeletalMesh * Skele
 	TArray<int32> Joints;
 	if (SkinIndex > INDEX_NONE)
 	{
-		TSharedPtr<FJsonObject> SkinObject = GetJsonObjectFromRootIndex("skins", SkinIndex);
+		TSharedPtr<FJsonObject> SkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Skins, SkinIndex);
 		if (!SkinObject)
 		{
 			return nullptr;
@@ -2341,6 +2677,7 @@ UAnimSequence* FglTFRuntimeParser::CreateAnimationFromPose(USkeletalMesh * Skele
 #if ENGINE_MAJOR_VERSION > 4
 	AnimSequence->CompressedData.CompressedDataStructure->CompressedNumberOfKeys = NumFrames;
 #endif
+	CompressionCodec->BuildPoseTracks();
 	AnimSequence->CompressedData.BoneCompressionCodec = CompressionCodec;
 	AnimSequence->CompressedData.CurveCompressionCodec = NewObject<UglTFAnimCurveCompressionCodec>();
 	AnimSequence->PostLoad();
@@ -2564,6 +2901,7 @@ UAnimSequence* FglTFRuntimeParser::CreateSkeletalAnimationFromPath(USkeletalMesh
 #if ENGINE_MAJOR_VERSION > 4
 	AnimSequence->CompressedData.CompressedDataStructure->CompressedNumberOfKeys = NumFrames;
 #endif
+	CompressionCodec->BuildPoseTracks();
 	AnimSequence->CompressedData.BoneCompressionCodec = CompressionCodec;
 	UglTFAnimCurveCompressionCodec* AnimCurveCompressionCodec = NewObject<UglTFAnimCurveCompressionCodec>();
 	AnimCurveCompressionCodec->AnimSequence = AnimSequence;
@@ -2606,7 +2944,7 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 	{
 		if (SkeletalAnimationConfig.RetargetSkinIndex > INDEX_NONE)
 		{
-			TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex("skins", SkeletalAnimationConfig.RetargetSkinIndex);
+			TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Skins, SkeletalAnimationConfig.RetargetSkinIndex);
 			if (!JsonSkinObject)
 			{
 				AddError("LoadSkeletalAnimation_Internal()", "Unable to find retarget skin.");
@@ -3042,7 +3380,7 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString & No
 		}
 		if (ChildNode.MeshIndex != INDEX_NONE)
 		{
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", ChildNode.MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, ChildNode.MeshIndex);
 			if (!JsonMeshObject)
 			{
 				AddError("LoadSkinnedMeshRecursiveAsRuntimeLOD()", FString::Printf(TEXT("Unable to find Mesh with index %d"), ChildNode.MeshIndex));
@@ -3062,7 +3400,7 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString & No
 
 			// Always build an override map, to have a cache of the bone/index mapping
 
-			TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex("skins", ChildNode.SkinIndex);
+			TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Skins, ChildNode.SkinIndex);
 			if (!JsonSkinObject)
 			{
 				AddError("LoadSkinnedMeshRecursiveAsRuntimeLOD()", FString::Printf(TEXT("Unable to fill skin %d"), ChildNode.SkinIndex));
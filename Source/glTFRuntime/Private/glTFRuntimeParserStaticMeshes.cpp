@@ -2,6 +2,8 @@
 
 #include "glTFRuntimeParser.h"
 #include "Async/Async.h"
+#include "glTFRuntimeTaskScheduler.h"
+#include "glTFRuntimeGameThreadQueue.h"
 #include "MeshDescription.h"
 #include "StaticMeshAttributes.h"
 #include "StaticMeshOperations.h"
@@ -51,18 +53,29 @@ FglTFRuntimeStaticMeshContext::FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRun
 void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, FglTFRuntimeStaticMeshAsync AsyncCallback, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
 	// first check cache
-	if (CanReadFromCache(StaticMeshConfig.CacheMode) && StaticMeshesCache.Contains(MeshIndex))
+	if (CanReadFromCache(StaticMeshConfig.CacheMode))
 	{
-		AsyncCallback.ExecuteIfBound(StaticMeshesCache[MeshIndex]);
-		return;
+		UStaticMesh* CachedStaticMesh = nullptr;
+		{
+			FScopeLock Lock(&StaticMeshesCacheLock);
+			if (UStaticMesh** StaticMeshPtr = StaticMeshesCache.Find(MeshIndex))
+			{
+				CachedStaticMesh = *StaticMeshPtr;
+			}
+		}
+		if (CachedStaticMesh)
+		{
+			AsyncCallback.ExecuteIfBound(CachedStaticMesh);
+			return;
+		}
 	}
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Get().Enqueue(AsyncTasksOwnerId, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
 		{
 
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 			if (JsonMeshObject)
 			{
 
@@ -75,24 +88,28 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, FglTFRuntime
 				}
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
+			FglTFRuntimeGameThreadQueue::Get().EnqueueResumable([MeshIndex, StaticMeshContext, AsyncCallback]()
 				{
-					if (StaticMeshContext->StaticMesh)
+					if (!StaticMeshContext->Parser->FinalizeStaticMeshStage(StaticMeshContext))
 					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
+						return false;
 					}
 
 					if (StaticMeshContext->StaticMesh)
 					{
 						if (StaticMeshContext->Parser->CanWriteToCache(StaticMeshContext->StaticMeshConfig.CacheMode))
 						{
+							FScopeLock Lock(&StaticMeshContext->Parser->StaticMeshesCacheLock);
 							StaticMeshContext->Parser->StaticMeshesCache.Add(MeshIndex, StaticMeshContext->StaticMesh);
 						}
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+					return true;
+				});
+		}, [AsyncCallback]()
+		{
+			FglTFRuntimeGameThreadQueue::Get().Enqueue([AsyncCallback]() { AsyncCallback.ExecuteIfBound(nullptr); });
 		});
 }
 
@@ -100,6 +117,8 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_LoadStaticMesh_Internal, FColor::Magenta);
 
+	GenerateStaticMeshLODs(StaticMeshContext);
+
 	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
 	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
 	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
@@ -132,8 +151,12 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 		int32 NumVertexInstancesPerLOD = 0;
 
-		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
+		// generated LODs only store indices, the attributes are shared with their source LOD
+		const FglTFRuntimeMeshLOD* AttributesLOD = LOD->SharedAttributesLOD ? LOD->SharedAttributesLOD : LOD;
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
+			const FglTFRuntimePrimitive& Primitive = AttributesLOD->Primitives[PrimitiveIndex];
 			if (Primitive.UVs.Num() > NumUVs)
 			{
 				NumUVs = Primitive.UVs.Num();
@@ -144,11 +167,11 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				bHasVertexColors = true;
 			}
 
-			NumVertexInstancesPerLOD += Primitive.Indices.Num();
+			NumVertexInstancesPerLOD += LOD->Primitives[PrimitiveIndex].Indices.Num();
 		}
 
 		TArray<FStaticMeshBuildVertex> StaticMeshBuildVertices;
-		StaticMeshBuildVertices.SetNum(NumVertexInstancesPerLOD);
+		StaticMeshBuildVertices.Reserve(NumVertexInstancesPerLOD);
 
 		FBox BoundingBox;
 		BoundingBox.Init();
@@ -159,14 +182,25 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 		int32 AdditionalTransformsPrimitiveIndex = 0; // used only when applying additional transforms
 
-		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
+		struct
+		{
+			int64 MissesBefore = 0;
+			int64 MissesAfter = 0;
+			int64 NumTriangles = 0;
+			int64 NumVertices = 0;
+		} OptimizationStats;
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD->Primitives.Num(); PrimitiveIndex++)
 		{
+			const FglTFRuntimePrimitive& Primitive = AttributesLOD->Primitives[PrimitiveIndex];
+			const TArray<uint32>& PrimitiveIndices = LOD->Primitives[PrimitiveIndex].Indices;
+
 			FName MaterialName = FName(FString::Printf(TEXT("LOD_%d_Section_%d_%s"), CurrentLODIndex, StaticMeshContext->StaticMaterials.Num(), *Primitive.MaterialName));
 			FStaticMaterial StaticMaterial(Primitive.Material, MaterialName);
 			StaticMaterial.UVChannelData.bInitialized = true;
 
 			FStaticMeshSection& Section = Sections.AddDefaulted_GetRef();
-			int32 NumVertexInstancesPerSection = Primitive.Indices.Num();
+			int32 NumVertexInstancesPerSection = PrimitiveIndices.Num();
 
 			Section.NumTriangles = NumVertexInstancesPerSection / 3;
 			Section.FirstIndex = VertexInstanceBaseIndex;
@@ -206,15 +240,42 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			bool bMissingTangents = false;
 			bool bMissingIgnore = false;
 
+			// one build vertex for each unique source vertex (in first use order), indices are remapped
+			const int32 NumSourceVertices = Primitive.Positions.Num();
+			for (const uint32 VertexIndex : PrimitiveIndices)
+			{
+				if (VertexIndex >= (uint32)NumSourceVertices)
+				{
+					AddError("LoadStaticMesh_Internal()", FString::Printf(TEXT("Invalid vertex index %u (%d vertices)"), VertexIndex, NumSourceVertices));
+					return nullptr;
+				}
+			}
+
+			TArray<int32> VertexRemap;
+			if (NumVertexInstancesPerSection > 0)
+			{
+				VertexRemap.SetNumUninitialized(NumSourceVertices);
+				FMemory::Memset(VertexRemap.GetData(), 0xFF, VertexRemap.Num() * VertexRemap.GetTypeSize());
+			}
+
+			const int32 SectionVertexBase = StaticMeshBuildVertices.Num();
+
 			LODIndices.AddUninitialized(NumVertexInstancesPerSection);
 
 			// Geometry generation
 			for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex++)
 			{
-				uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
-				LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexInstanceBaseIndex + VertexInstanceSectionIndex;
+				uint32 VertexIndex = PrimitiveIndices[VertexInstanceSectionIndex];
+				if (VertexRemap[VertexIndex] != INDEX_NONE)
+				{
+					LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexRemap[VertexIndex];
+					continue;
+				}
+
+				VertexRemap[VertexIndex] = StaticMeshBuildVertices.Num();
+				LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = VertexRemap[VertexIndex];
 
-				FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
+				FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices.AddDefaulted_GetRef();
 
 #if ENGINE_MAJOR_VERSION > 4
 				StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
@@ -254,8 +315,8 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 					else
 					{
 						StaticMeshVertex.Color = FColor::White;
-				}
 					}
+				}
 
 				if (bApplyAdditionalTransforms)
 				{
@@ -277,7 +338,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 #else
 				BoundingBox += StaticMeshVertex.Position;
 #endif
-				}
+			}
 			// End of Geometry generation
 
 			AdditionalTransformsPrimitiveIndex++;
@@ -286,11 +347,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			{
 				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
 				{
-					FStaticMeshBuildVertex StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-					FStaticMeshBuildVertex StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
-
-					StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1] = StaticMeshVertex2;
-					StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2] = StaticMeshVertex1;
+					Swap(LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1], LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2]);
 				}
 			}
 
@@ -298,11 +355,22 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
 			if (bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0)
 			{
+				// flat normals require a vertex for each index
+				TArray<FStaticMeshBuildVertex> SectionBuildVertices;
+				SectionBuildVertices.Reserve(NumVertexInstancesPerSection);
+				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex++)
+				{
+					SectionBuildVertices.Add(StaticMeshBuildVertices[LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex]]);
+					LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = SectionVertexBase + VertexInstanceSectionIndex;
+				}
+				StaticMeshBuildVertices.SetNum(SectionVertexBase, false);
+				StaticMeshBuildVertices.Append(MoveTemp(SectionBuildVertices));
+
 				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
 				{
-					FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
-					FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-					FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
+					FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex]];
+					FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1]];
+					FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2]];
 
 #if ENGINE_MAJOR_VERSION > 4
 					FVector SideA = FVector(StaticMeshVertex1.Position - StaticMeshVertex0.Position);
@@ -321,105 +389,155 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 					StaticMeshVertex1.TangentZ = NormalFromCross;
 					StaticMeshVertex2.TangentZ = NormalFromCross;
 #endif
-
-
 				}
 				bMissingNormals = false;
-				}
+			}
 
 			const bool bCanGenerateTangents = (bMissingTangents && StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing) ||
 				StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always;
 			// recompute tangents if required (need normals and uvs)
 			if (bCanGenerateTangents && !bMissingNormals && Primitive.UVs.Num() > 0 && (NumVertexInstancesPerSection % 3) == 0)
 			{
+				// triangle tangents are accumulated on shared vertices
+				TArray<FVector> SectionTangentsX;
+				SectionTangentsX.AddZeroed(StaticMeshBuildVertices.Num() - SectionVertexBase);
+
 				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
 				{
-					FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
-					FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-					FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
-
-
-#if ENGINE_MAJOR_VERSION > 4
-					FVector Position0 = FVector(StaticMeshVertex0.Position);
-					FVector4 TangentZ0 = FVector(StaticMeshVertex0.TangentZ);
-					FVector2D UV0 = FVector2D(StaticMeshVertex0.UVs[0]);
-#else
-					FVector Position0 = StaticMeshVertex0.Position;
-					FVector4 TangentZ0 = StaticMeshVertex0.TangentZ;
-					FVector2D UV0 = StaticMeshVertex0.UVs[0];
-#endif
-
-
+					const int32 Index0 = LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
+					const int32 Index1 = LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
+					const int32 Index2 = LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
 
 #if ENGINE_MAJOR_VERSION > 4
-					FVector Position1 = FVector(StaticMeshVertex1.Position);
-					FVector4 TangentZ1 = FVector(StaticMeshVertex1.TangentZ);
-					FVector2D UV1 = FVector2D(StaticMeshVertex1.UVs[0]);
+					FVector Position0 = FVector(StaticMeshBuildVertices[Index0].Position);
+					FVector2D UV0 = FVector2D(StaticMeshBuildVertices[Index0].UVs[0]);
+					FVector Position1 = FVector(StaticMeshBuildVertices[Index1].Position);
+					FVector2D UV1 = FVector2D(StaticMeshBuildVertices[Index1].UVs[0]);
+					FVector Position2 = FVector(StaticMeshBuildVertices[Index2].Position);
+					FVector2D UV2 = FVector2D(StaticMeshBuildVertices[Index2].UVs[0]);
 #else
-					FVector Position1 = StaticMeshVertex1.Position;
-					FVector4 TangentZ1 = StaticMeshVertex1.TangentZ;
-					FVector2D UV1 = StaticMeshVertex1.UVs[0];
+					FVector Position0 = StaticMeshBuildVertices[Index0].Position;
+					FVector2D UV0 = StaticMeshBuildVertices[Index0].UVs[0];
+					FVector Position1 = StaticMeshBuildVertices[Index1].Position;
+					FVector2D UV1 = StaticMeshBuildVertices[Index1].UVs[0];
+					FVector Position2 = StaticMeshBuildVertices[Index2].Position;
+					FVector2D UV2 = StaticMeshBuildVertices[Index2].UVs[0];
 #endif
 
-
-
-#if ENGINE_MAJOR_VERSION > 4
-					FVector Position2 = FVector(StaticMeshVertex2.Position);
-					FVector4 TangentZ2 = FVector(StaticMeshVertex2.TangentZ);
-					FVector2D UV2 = FVector2D(StaticMeshVertex2.UVs[0]);
-#else
-					FVector Position2 = StaticMeshVertex2.Position;
-					FVector4 TangentZ2 = StaticMeshVertex2.TangentZ;
-					FVector2D UV2 = StaticMeshVertex2.UVs[0];
-#endif
-
-
 					FVector DeltaPosition0 = Position1 - Position0;
 					FVector DeltaPosition1 = Position2 - Position0;
 
 					FVector2D DeltaUV0 = UV1 - UV0;
 					FVector2D DeltaUV1 = UV2 - UV0;
 
-					float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
+					const float Determinant = DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X;
+					// degenerate uvs would pollute the shared vertices
+					if (FMath::IsNearlyZero(Determinant))
+					{
+						continue;
+					}
 
-					FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-					FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
+					float Factor = 1.0f / Determinant;
 
-					FVector TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-					TangentX0.Normalize();
+					FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
 
-					FVector TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-					TangentX1.Normalize();
+					SectionTangentsX[Index0 - SectionVertexBase] += TriangleTangentX;
+					SectionTangentsX[Index1 - SectionVertexBase] += TriangleTangentX;
+					SectionTangentsX[Index2 - SectionVertexBase] += TriangleTangentX;
+				}
 
-					FVector TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-					TangentX2.Normalize();
+				for (int32 SectionVertexIndex = 0; SectionVertexIndex < SectionTangentsX.Num(); SectionVertexIndex++)
+				{
+					FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[SectionVertexBase + SectionVertexIndex];
+#if ENGINE_MAJOR_VERSION > 4
+					const FVector TangentZ = FVector(StaticMeshVertex.TangentZ);
+#else
+					const FVector TangentZ = StaticMeshVertex.TangentZ;
+#endif
+					FVector TangentX = SectionTangentsX[SectionVertexIndex] - (TangentZ * FVector::DotProduct(TangentZ, SectionTangentsX[SectionVertexIndex]));
+					if (!TangentX.Normalize())
+					{
+						continue;
+					}
 
 #if ENGINE_MAJOR_VERSION > 4
-					StaticMeshVertex0.TangentX = FVector3f(TangentX0);
-					StaticMeshVertex0.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex0.TangentZ), FVector(StaticMeshVertex0.TangentX)) * TangentsDirection);
+					StaticMeshVertex.TangentX = FVector3f(TangentX);
+					StaticMeshVertex.TangentY = FVector3f(ComputeTangentY(TangentZ, TangentX) * TangentsDirection);
+#else
+					StaticMeshVertex.TangentX = TangentX;
+					StaticMeshVertex.TangentY = ComputeTangentY(TangentZ, TangentX) * TangentsDirection;
+#endif
+				}
+			}
 
-					StaticMeshVertex1.TangentX = FVector3f(TangentX1);
-					StaticMeshVertex1.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex1.TangentZ), FVector(StaticMeshVertex1.TangentX)) * TangentsDirection);
+			if ((StaticMeshConfig.bOptimizeVertexCache || StaticMeshConfig.bOptimizeVertexFetch) && NumVertexInstancesPerSection > 0 && (NumVertexInstancesPerSection % 3) == 0)
+			{
+				const int32 NumSectionVertices = StaticMeshBuildVertices.Num() - SectionVertexBase;
+				TArray<uint32> SectionIndices;
+				SectionIndices.AddUninitialized(NumVertexInstancesPerSection);
+				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex++)
+				{
+					SectionIndices[VertexInstanceSectionIndex] = LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] - SectionVertexBase;
+				}
 
-					StaticMeshVertex2.TangentX = FVector3f(TangentX2);
-					StaticMeshVertex2.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex2.TangentZ), FVector(StaticMeshVertex2.TangentX)) * TangentsDirection);
-#else
-					StaticMeshVertex0.TangentX = TangentX0;
-					StaticMeshVertex0.TangentY = ComputeTangentY(StaticMeshVertex0.TangentZ, StaticMeshVertex0.TangentX) * TangentsDirection;
+				OptimizationStats.MissesBefore += CountVertexCacheMisses(SectionIndices, NumSectionVertices);
 
-					StaticMeshVertex1.TangentX = TangentX1;
-					StaticMeshVertex1.TangentY = ComputeTangentY(StaticMeshVertex1.TangentZ, StaticMeshVertex1.TangentX) * TangentsDirection;
+				if (StaticMeshConfig.bOptimizeVertexCache)
+				{
+					OptimizeVertexCache(SectionIndices, NumSectionVertices);
+					if (StaticMeshConfig.bOptimizeOverdraw)
+					{
+						TArray<FVector> SectionPositions;
+						SectionPositions.AddUninitialized(NumSectionVertices);
+						for (int32 SectionVertexIndex = 0; SectionVertexIndex < NumSectionVertices; SectionVertexIndex++)
+						{
+							SectionPositions[SectionVertexIndex] = FVector(StaticMeshBuildVertices[SectionVertexBase + SectionVertexIndex].Position);
+						}
+						OptimizeOverdraw(SectionIndices, SectionPositions);
+					}
+				}
 
-					StaticMeshVertex2.TangentX = TangentX2;
-					StaticMeshVertex2.TangentY = ComputeTangentY(StaticMeshVertex2.TangentZ, StaticMeshVertex2.TangentX) * TangentsDirection;
-#endif
+				if (StaticMeshConfig.bOptimizeVertexFetch)
+				{
+					TArray<int32> VertexFetchRemap;
+					const int32 NumUsedVertices = OptimizeVertexFetchRemap(SectionIndices, NumSectionVertices, VertexFetchRemap);
+					TArray<FStaticMeshBuildVertex> SectionBuildVertices;
+					SectionBuildVertices.SetNum(NumUsedVertices);
+					for (int32 SectionVertexIndex = 0; SectionVertexIndex < NumSectionVertices; SectionVertexIndex++)
+					{
+						if (VertexFetchRemap[SectionVertexIndex] != INDEX_NONE)
+						{
+							SectionBuildVertices[VertexFetchRemap[SectionVertexIndex]] = StaticMeshBuildVertices[SectionVertexBase + SectionVertexIndex];
+						}
+					}
+					StaticMeshBuildVertices.SetNum(SectionVertexBase, false);
+					StaticMeshBuildVertices.Append(MoveTemp(SectionBuildVertices));
+				}
 
-			}
+				OptimizationStats.MissesAfter += CountVertexCacheMisses(SectionIndices, NumSectionVertices);
+				OptimizationStats.NumTriangles += NumVertexInstancesPerSection / 3;
+				OptimizationStats.NumVertices += NumSectionVertices;
+
+				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex++)
+				{
+					LODIndices[VertexInstanceBaseIndex + VertexInstanceSectionIndex] = SectionIndices[VertexInstanceSectionIndex] + SectionVertexBase;
+				}
 			}
 
+			Section.MinVertexIndex = SectionVertexBase;
+			Section.MaxVertexIndex = FMath::Max(SectionVertexBase, StaticMeshBuildVertices.Num() - 1);
+
 			VertexInstanceBaseIndex += NumVertexInstancesPerSection;
 		}
 
+		if (OptimizationStats.NumTriangles > 0)
+		{
+			// average cache miss ratio (per triangle) and average transformed vertex ratio (per vertex) with a 16 entries FIFO cache
+			UE_LOG(LogGLTFRuntime, Log, TEXT("StaticMesh LOD %d optimized: ACMR %f -> %f ATVR %f -> %f"), CurrentLODIndex,
+				OptimizationStats.MissesBefore / static_cast<double>(OptimizationStats.NumTriangles), OptimizationStats.MissesAfter / static_cast<double>(OptimizationStats.NumTriangles),
+				OptimizationStats.MissesBefore / static_cast<double>(OptimizationStats.NumVertices), OptimizationStats.MissesAfter / static_cast<double>(OptimizationStats.NumVertices));
+		}
+
 		// check for pivot repositioning
 		if (StaticMeshConfig.PivotPosition != EglTFRuntimePivotPosition::Asset)
 		{
@@ -477,7 +595,8 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 		{
 			LODResources.IndexBuffer = FRawStaticIndexBuffer(true);
 			}
-		LODResources.IndexBuffer.SetIndices(LODIndices, EIndexBufferStride::Force32Bit);
+		// 16 bit indices are enough for most of the LODs (halving the index buffer size)
+		LODResources.IndexBuffer.SetIndices(LODIndices, StaticMeshBuildVertices.Num() <= MAX_uint16 + 1 ? EIndexBufferStride::Force16Bit : EIndexBufferStride::Force32Bit);
 
 #if WITH_EDITOR
 		if (StaticMeshConfig.bGenerateStaticMeshDescription)
@@ -570,160 +689,208 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FinalizeStaticMesh, FColor::Magenta);
 
+	while (!FinalizeStaticMeshStage(StaticMeshContext))
+	{
+	}
+
+	return StaticMeshContext->StaticMesh;
+}
+
+bool FglTFRuntimeParser::FinalizeStaticMeshStage(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext)
+{
 	UStaticMesh* StaticMesh = StaticMeshContext->StaticMesh;
 	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
 	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
 
-#if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MINOR_VERSION > 26)
-	StaticMesh->SetStaticMaterials(StaticMeshContext->StaticMaterials);
-#else
-	StaticMesh->StaticMaterials = StaticMeshContext->StaticMaterials;
-#endif
+	if (!StaticMesh || StaticMeshContext->FinalizeStage == EglTFRuntimeStaticMeshFinalizeStage::Completed)
+	{
+		return true;
+	}
+
+	switch (StaticMeshContext->FinalizeStage)
+	{
+	case EglTFRuntimeStaticMeshFinalizeStage::Resources:
+	{
+		FglTFRuntimeScopedStageStats StageStats(TEXT("StaticMesh.Resources"));
 
 #if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MINOR_VERSION > 26)
-	UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+		StaticMesh->SetStaticMaterials(StaticMeshContext->StaticMaterials);
 #else
-	UBodySetup* BodySetup = StaticMesh->BodySetup;
+		StaticMesh->StaticMaterials = StaticMeshContext->StaticMaterials;
 #endif
 
-	StaticMesh->InitResources();
+		StaticMesh->InitResources();
 
-	// set default LODs screen sizes
-	float DeltaScreenSize = (1.0f / RenderData->LODResources.Num()) / 2.0f;
-	float ScreenSize = 1;
-	for (int32 LODIndex = 0; LODIndex < RenderData->LODResources.Num(); LODIndex++)
-	{
-		RenderData->ScreenSize[LODIndex].Default = ScreenSize;
-		ScreenSize -= DeltaScreenSize;
-}
+		// set default LODs screen sizes
+		float DeltaScreenSize = (1.0f / RenderData->LODResources.Num()) / 2.0f;
+		float ScreenSize = 1;
+		for (int32 LODIndex = 0; LODIndex < RenderData->LODResources.Num(); LODIndex++)
+		{
+			RenderData->ScreenSize[LODIndex].Default = ScreenSize;
+			ScreenSize -= DeltaScreenSize;
+		}
 
-	// Override LODs ScreenSize
-	for (const TPair<int32, float>& Pair : StaticMeshConfig.LODScreenSize)
-	{
-		int32 CurrentLODIndex = Pair.Key;
-		if (RenderData && CurrentLODIndex >= 0 && CurrentLODIndex < RenderData->LODResources.Num())
+		// Override LODs ScreenSize
+		for (const TPair<int32, float>& Pair : StaticMeshConfig.LODScreenSize)
 		{
-			RenderData->ScreenSize[CurrentLODIndex].Default = Pair.Value;
+			int32 CurrentLODIndex = Pair.Key;
+			if (RenderData && CurrentLODIndex >= 0 && CurrentLODIndex < RenderData->LODResources.Num())
+			{
+				RenderData->ScreenSize[CurrentLODIndex].Default = Pair.Value;
+			}
 		}
-	}
 
-	RenderData->Bounds = StaticMeshContext->BoundingBoxAndSphere;
-	StaticMesh->CalculateExtendedBounds();
+		RenderData->Bounds = StaticMeshContext->BoundingBoxAndSphere;
+		StaticMesh->CalculateExtendedBounds();
 
-	if (!BodySetup)
+		StaticMeshContext->FinalizeStage = EglTFRuntimeStaticMeshFinalizeStage::Collision;
+		return false;
+	}
+	case EglTFRuntimeStaticMeshFinalizeStage::Collision:
 	{
-		StaticMesh->CreateBodySetup();
+		FglTFRuntimeScopedStageStats StageStats(TEXT("StaticMesh.Collision"));
+
 #if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MINOR_VERSION > 26)
-		BodySetup = StaticMesh->GetBodySetup();
+		UBodySetup* BodySetup = StaticMesh->GetBodySetup();
 #else
-		BodySetup = StaticMesh->BodySetup;
+		UBodySetup* BodySetup = StaticMesh->BodySetup;
 #endif
-	}
 
-	BodySetup->bHasCookedCollisionData = false;
+		if (!BodySetup)
+		{
+			StaticMesh->CreateBodySetup();
+#if ENGINE_MAJOR_VERSION > 4 || (ENGINE_MINOR_VERSION > 26)
+			BodySetup = StaticMesh->GetBodySetup();
+#else
+			BodySetup = StaticMesh->BodySetup;
+#endif
+		}
 
-	BodySetup->bNeverNeedsCookedCollisionData = !StaticMeshConfig.bBuildComplexCollision;
+		BodySetup->bHasCookedCollisionData = false;
 
-	BodySetup->bMeshCollideAll = false;
-	BodySetup->bHasCookedCollisionData = false;
-	BodySetup->CollisionTraceFlag = StaticMeshConfig.CollisionComplexity;
+		BodySetup->bNeverNeedsCookedCollisionData = !StaticMeshConfig.bBuildComplexCollision;
 
-	BodySetup->InvalidatePhysicsData();
+		BodySetup->bMeshCollideAll = false;
+		BodySetup->bHasCookedCollisionData = false;
+		BodySetup->CollisionTraceFlag = StaticMeshConfig.CollisionComplexity;
 
-	if (StaticMeshConfig.bBuildSimpleCollision)
-	{
-		FKBoxElem BoxElem;
-		BoxElem.Center = RenderData->Bounds.Origin;
-		BoxElem.X = RenderData->Bounds.BoxExtent.X * 2.0f;
-		BoxElem.Y = RenderData->Bounds.BoxExtent.Y * 2.0f;
-		BoxElem.Z = RenderData->Bounds.BoxExtent.Z * 2.0f;
-		BodySetup->AggGeom.BoxElems.Add(BoxElem);
-	}
+		BodySetup->InvalidatePhysicsData();
 
-	for (const FBox& Box : StaticMeshConfig.BoxCollisions)
-	{
-		FKBoxElem BoxElem;
-		BoxElem.Center = Box.GetCenter();
-		FVector BoxSize = Box.GetSize();
-		BoxElem.X = BoxSize.X;
-		BoxElem.Y = BoxSize.Y;
-		BoxElem.Z = BoxSize.Z;
-		BodySetup->AggGeom.BoxElems.Add(BoxElem);
-	}
+		if (StaticMeshConfig.bBuildSimpleCollision)
+		{
+			FKBoxElem BoxElem;
+			BoxElem.Center = RenderData->Bounds.Origin;
+			BoxElem.X = RenderData->Bounds.BoxExtent.X * 2.0f;
+			BoxElem.Y = RenderData->Bounds.BoxExtent.Y * 2.0f;
+			BoxElem.Z = RenderData->Bounds.BoxExtent.Z * 2.0f;
+			BodySetup->AggGeom.BoxElems.Add(BoxElem);
+		}
 
-	for (const FVector4 Sphere : StaticMeshConfig.SphereCollisions)
-	{
-		FKSphereElem SphereElem;
-		SphereElem.Center = Sphere;
-		SphereElem.Radius = Sphere.W;
-		BodySetup->AggGeom.SphereElems.Add(SphereElem);
-	}
+		for (const FBox& Box : StaticMeshConfig.BoxCollisions)
+		{
+			FKBoxElem BoxElem;
+			BoxElem.Center = Box.GetCenter();
+			FVector BoxSize = Box.GetSize();
+			BoxElem.X = BoxSize.X;
+			BoxElem.Y = BoxSize.Y;
+			BoxElem.Z = BoxSize.Z;
+			BodySetup->AggGeom.BoxElems.Add(BoxElem);
+		}
 
-	if (StaticMeshConfig.bBuildComplexCollision || StaticMeshConfig.CollisionComplexity == ECollisionTraceFlag::CTF_UseComplexAsSimple)
-	{
-		if (!StaticMesh->bAllowCPUAccess || !StaticMeshConfig.Outer || !StaticMesh->GetWorld() || !StaticMesh->GetWorld()->IsGameWorld())
+		for (const FVector4 Sphere : StaticMeshConfig.SphereCollisions)
 		{
-			AddError("FinalizeStaticMesh", "Unable to generate Complex collision without CpuAccess and a valid StaticMesh Outer (consider setting it to the related StaticMeshComponent)");
+			FKSphereElem SphereElem;
+			SphereElem.Center = Sphere;
+			SphereElem.Radius = Sphere.W;
+			BodySetup->AggGeom.SphereElems.Add(SphereElem);
 		}
-		BodySetup->CreatePhysicsMeshes();
-	}
 
-	// recreate physics state (if possible)
-	if (UActorComponent* ActorComponent = Cast<UActorComponent>(StaticMesh->GetOuter()))
-	{
-		ActorComponent->RecreatePhysicsState();
-	}
+		if (StaticMeshConfig.bBuildComplexCollision || StaticMeshConfig.CollisionComplexity == ECollisionTraceFlag::CTF_UseComplexAsSimple)
+		{
+			if (!StaticMesh->bAllowCPUAccess || !StaticMeshConfig.Outer || !StaticMesh->GetWorld() || !StaticMesh->GetWorld()->IsGameWorld())
+			{
+				AddError("FinalizeStaticMesh", "Unable to generate Complex collision without CpuAccess and a valid StaticMesh Outer (consider setting it to the related StaticMeshComponent)");
+			}
+			BodySetup->CreatePhysicsMeshes();
+		}
 
-	for (const TPair<FString, FTransform>& Pair : StaticMeshConfig.Sockets)
-	{
-		UStaticMeshSocket* Socket = NewObject<UStaticMeshSocket>(StaticMesh);
-		Socket->SocketName = FName(Pair.Key);
-		Socket->RelativeLocation = Pair.Value.GetLocation();
-		Socket->RelativeRotation = Pair.Value.Rotator();
-		Socket->RelativeScale = Pair.Value.GetScale3D();
-		StaticMesh->AddSocket(Socket);
-	}
+		// recreate physics state (if possible)
+		if (UActorComponent* ActorComponent = Cast<UActorComponent>(StaticMesh->GetOuter()))
+		{
+			ActorComponent->RecreatePhysicsState();
+		}
 
-	for (const TPair<FString, FTransform>& Pair : StaticMeshContext->AdditionalSockets)
+		StaticMeshContext->FinalizeStage = EglTFRuntimeStaticMeshFinalizeStage::Sockets;
+		return false;
+	}
+	case EglTFRuntimeStaticMeshFinalizeStage::Sockets:
 	{
-		if (StaticMeshConfig.Sockets.Contains(Pair.Key))
+		FglTFRuntimeScopedStageStats StageStats(TEXT("StaticMesh.Sockets"));
+
+		for (const TPair<FString, FTransform>& Pair : StaticMeshConfig.Sockets)
 		{
-			continue;
+			UStaticMeshSocket* Socket = NewObject<UStaticMeshSocket>(StaticMesh);
+			Socket->SocketName = FName(Pair.Key);
+			Socket->RelativeLocation = Pair.Value.GetLocation();
+			Socket->RelativeRotation = Pair.Value.Rotator();
+			Socket->RelativeScale = Pair.Value.GetScale3D();
+			StaticMesh->AddSocket(Socket);
 		}
 
-		UStaticMeshSocket* Socket = NewObject<UStaticMeshSocket>(StaticMesh);
-		Socket->SocketName = FName(Pair.Key);
-		Socket->RelativeLocation = Pair.Value.GetLocation();
-		Socket->RelativeRotation = Pair.Value.Rotator();
-		Socket->RelativeScale = Pair.Value.GetScale3D();
-		StaticMesh->AddSocket(Socket);
-	}
+		for (const TPair<FString, FTransform>& Pair : StaticMeshContext->AdditionalSockets)
+		{
+			if (StaticMeshConfig.Sockets.Contains(Pair.Key))
+			{
+				continue;
+			}
 
-	if (!StaticMeshConfig.ExportOriginalPivotToSocket.IsEmpty())
-	{
-		UStaticMeshSocket* Socket = NewObject<UStaticMeshSocket>(StaticMesh);
-		Socket->SocketName = FName(StaticMeshConfig.ExportOriginalPivotToSocket);
-		Socket->RelativeLocation = -StaticMeshContext->LOD0PivotDelta;
-		StaticMesh->AddSocket(Socket);
-	}
+			UStaticMeshSocket* Socket = NewObject<UStaticMeshSocket>(StaticMesh);
+			Socket->SocketName = FName(Pair.Key);
+			Socket->RelativeLocation = Pair.Value.GetLocation();
+			Socket->RelativeRotation = Pair.Value.Rotator();
+			Socket->RelativeScale = Pair.Value.GetScale3D();
+			StaticMesh->AddSocket(Socket);
+		}
 
-	StaticMesh->bHasNavigationData = StaticMeshConfig.bBuildNavCollision;
+		if (!StaticMeshConfig.ExportOriginalPivotToSocket.IsEmpty())
+		{
+			UStaticMeshSocket* Socket = NewObject<UStaticMeshSocket>(StaticMesh);
+			Socket->SocketName = FName(StaticMeshConfig.ExportOriginalPivotToSocket);
+			Socket->RelativeLocation = -StaticMeshContext->LOD0PivotDelta;
+			StaticMesh->AddSocket(Socket);
+		}
 
-	if (StaticMesh->bHasNavigationData)
-	{
-		StaticMesh->CreateNavCollision();
+		StaticMeshContext->FinalizeStage = EglTFRuntimeStaticMeshFinalizeStage::Navigation;
+		return false;
 	}
+	case EglTFRuntimeStaticMeshFinalizeStage::Navigation:
+	{
+		FglTFRuntimeScopedStageStats StageStats(TEXT("StaticMesh.Navigation"));
 
-	OnFinalizedStaticMesh.Broadcast(AsShared(), StaticMesh, StaticMeshConfig);
+		StaticMesh->bHasNavigationData = StaticMeshConfig.bBuildNavCollision;
 
-	if (OnStaticMeshCreated.IsBound())
-	{
-		OnStaticMeshCreated.Broadcast(StaticMesh);
-	}
+		if (StaticMesh->bHasNavigationData)
+		{
+			StaticMesh->CreateNavCollision();
+		}
 
-	return StaticMesh;
+		OnFinalizedStaticMesh.Broadcast(AsShared(), StaticMesh, StaticMeshConfig);
+
+		if (OnStaticMeshCreated.IsBound())
+		{
+			OnStaticMeshCreated.Broadcast(StaticMesh);
 		}
 
+		StaticMeshContext->FinalizeStage = EglTFRuntimeStaticMeshFinalizeStage::Completed;
+		break;
+	}
+	default:
+		break;
+	}
+
+	return true;
+}
+
 bool FglTFRuntimeParser::LoadStaticMeshes(TArray<UStaticMesh*>& StaticMeshes, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
 	const TArray<TSharedPtr<FJsonValue>>* JsonMeshes;
@@ -748,10 +915,13 @@ bool FglTFRuntimeParser::LoadStaticMeshes(TArray<UStaticMesh*>& StaticMeshes, co
 
 bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
-	if (LODsCache.Contains(JsonMeshObject))
 	{
-		LOD = &LODsCache[JsonMeshObject];
-		return true;
+		FScopeLock Lock(&LODsCacheLock);
+		if (TSharedRef<FglTFRuntimeMeshLOD>* CachedLOD = LODsCache.Find(JsonMeshObject))
+		{
+			LOD = &CachedLOD->Get();
+			return true;
+		}
 	}
 
 	TArray<FglTFRuntimePrimitive> Primitives;
@@ -760,26 +930,37 @@ bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObj
 		return false;
 	}
 
-	FglTFRuntimeMeshLOD NewLOD;
-	NewLOD.Primitives = MoveTemp(Primitives);
+	TSharedRef<FglTFRuntimeMeshLOD> NewLOD = MakeShared<FglTFRuntimeMeshLOD>();
+	NewLOD->Primitives = MoveTemp(Primitives);
+
+	FScopeLock Lock(&LODsCacheLock);
+	// the first thread completing the loading wins
+	if (TSharedRef<FglTFRuntimeMeshLOD>* CachedLOD = LODsCache.Find(JsonMeshObject))
+	{
+		LOD = &CachedLOD->Get();
+		return true;
+	}
 
-	FglTFRuntimeMeshLOD& CachedLOD = LODsCache.Add(JsonMeshObject, MoveTemp(NewLOD));
-	LOD = &CachedLOD;
+	LOD = &LODsCache.Add(JsonMeshObject, NewLOD).Get();
 	return true;
 }
 
 UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return nullptr;
 	}
 
-	if (CanReadFromCache(StaticMeshConfig.CacheMode) && StaticMeshesCache.Contains(MeshIndex))
+	if (CanReadFromCache(StaticMeshConfig.CacheMode))
 	{
-		return StaticMeshesCache[MeshIndex];
+		FScopeLock Lock(&StaticMeshesCacheLock);
+		if (UStaticMesh** CachedStaticMesh = StaticMeshesCache.Find(MeshIndex))
+		{
+			return *CachedStaticMesh;
+		}
 	}
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
@@ -804,6 +985,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const Fgl
 
 	if (CanWriteToCache(StaticMeshConfig.CacheMode))
 	{
+		FScopeLock Lock(&StaticMeshesCacheLock);
 		StaticMeshesCache.Add(MeshIndex, StaticMesh);
 	}
 
@@ -814,7 +996,7 @@ TArray<UStaticMesh*> FglTFRuntimeParser::LoadStaticMeshesFromPrimitives(const in
 {
 	TArray<UStaticMesh*> StaticMeshes;
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return StaticMeshes;
@@ -860,7 +1042,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshLODs(const TArray<int32>& MeshInd
 
 	for (const int32 MeshIndex : MeshIndices)
 	{
-		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 		if (!JsonMeshObject)
 		{
 			return nullptr;
@@ -888,12 +1070,12 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Get().Enqueue(AsyncTasksOwnerId, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
 		{
 			bool bSuccess = true;
 			for (const int32 MeshIndex : MeshIndices)
 			{
-				TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+				TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 				if (!JsonMeshObject)
 				{
 					bSuccess = false;
@@ -916,16 +1098,19 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FglTFRuntimeGameThreadQueue::Get().EnqueueResumable([StaticMeshContext, AsyncCallback]()
 				{
-					if (StaticMeshContext->StaticMesh)
+					if (!StaticMeshContext->Parser->FinalizeStaticMeshStage(StaticMeshContext))
 					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
+						return false;
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+					return true;
+				});
+		}, [AsyncCallback]()
+		{
+			FglTFRuntimeGameThreadQueue::Get().Enqueue([AsyncCallback]() { AsyncCallback.ExecuteIfBound(nullptr); });
 		});
 }
 
@@ -936,7 +1121,7 @@ bool FglTFRuntimeParser::LoadStaticMeshIntoProceduralMeshComponent(const int32 M
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return false;
@@ -1064,7 +1249,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshRecursive(const FString& NodeName
 
 		if (ChildNode.MeshIndex != INDEX_NONE)
 		{
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", ChildNode.MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, ChildNode.MeshIndex);
 			if (!JsonMeshObject)
 			{
 				return nullptr;
@@ -1117,7 +1302,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Get().Enqueue(AsyncTasksOwnerId, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
 		{
 
 			FglTFRuntimeNode Node;
@@ -1156,7 +1341,8 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 				}
 			}
 
-			FglTFRuntimeMeshLOD CombinedLOD;
+			// the LOD must survive the worker, the game thread finalization is not waited for
+			FglTFRuntimeMeshLOD& CombinedLOD = StaticMeshContext->CachedRuntimeMeshLODs.AddDefaulted_GetRef();
 
 			for (FglTFRuntimeNode& ChildNode : Nodes)
 			{
@@ -1167,7 +1353,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 				if (ChildNode.MeshIndex != INDEX_NONE)
 				{
-					TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", ChildNode.MeshIndex);
+					TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, ChildNode.MeshIndex);
 					if (!JsonMeshObject)
 					{
 						return;
@@ -1207,22 +1393,25 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FglTFRuntimeGameThreadQueue::Get().EnqueueResumable([StaticMeshContext, AsyncCallback]()
 				{
-					if (StaticMeshContext->StaticMesh)
+					if (!StaticMeshContext->Parser->FinalizeStaticMeshStage(StaticMeshContext))
 					{
-						StaticMeshContext->StaticMesh = StaticMeshContext->Parser->FinalizeStaticMesh(StaticMeshContext);
+						return false;
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+					return true;
+				});
+		}, [AsyncCallback]()
+		{
+			FglTFRuntimeGameThreadQueue::Get().Enqueue([AsyncCallback]() { AsyncCallback.ExecuteIfBound(nullptr); });
 		});
 }
 
 bool FglTFRuntimeParser::LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeRootArray::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return false;
@@ -0,0 +1,249 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeTaskScheduler.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarglTFRuntimeMaxConcurrentAsyncTasks(
+	TEXT("glTFRuntime.MaxConcurrentAsyncTasks"),
+	0,
+	TEXT("Max number of glTFRuntime async loads running at the same time, 0 means the number of worker threads."),
+	ECVF_Default);
+
+FglTFRuntimeTaskScheduler& FglTFRuntimeTaskScheduler::Get()
+{
+	static FglTFRuntimeTaskScheduler Scheduler;
+	return Scheduler;
+}
+
+FglTFRuntimeTaskScheduler::FglTFRuntimeTaskScheduler()
+{
+	NumRunning = 0;
+	ThreadPool = nullptr;
+	NumPoolThreads = 0;
+}
+
+void FglTFRuntimeTaskScheduler::Startup()
+{
+	FScopeLock Lock(&TasksLock);
+	if (ThreadPool)
+	{
+		return;
+	}
+
+	NumPoolThreads = FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+	ThreadPool = FQueuedThreadPool::Allocate();
+	// meshes processing can be stack hungry
+	ThreadPool->Create(NumPoolThreads, 512 * 1024, TPri_Normal, TEXT("glTFRuntimeThreadPool"));
+}
+
+void FglTFRuntimeTaskScheduler::Shutdown()
+{
+	FQueuedThreadPool* OldThreadPool = nullptr;
+	TArray<TSharedRef<FglTFRuntimeTask>> CancelledTasks;
+	{
+		FScopeLock Lock(&TasksLock);
+		OldThreadPool = ThreadPool;
+		ThreadPool = nullptr;
+		NumPoolThreads = 0;
+		for (TArray<TSharedRef<FglTFRuntimeTask>>& Tasks : PendingTasks)
+		{
+			CancelledTasks.Append(Tasks);
+			Tasks.Empty();
+		}
+	}
+
+	for (const TSharedRef<FglTFRuntimeTask>& Task : CancelledTasks)
+	{
+		if (Task->OnCancelled)
+		{
+			Task->OnCancelled();
+		}
+	}
+
+	// the running tasks are completed (the game thread queue must be already shut down, so that they cannot wait for it)
+	if (OldThreadPool)
+	{
+		OldThreadPool->Destroy();
+		delete OldThreadPool;
+	}
+}
+
+uint64 FglTFRuntimeTaskScheduler::NewOwnerId()
+{
+	static volatile int64 LastOwnerId = 0;
+	return (uint64)FPlatformAtomics::InterlockedIncrement(&LastOwnerId);
+}
+
+void FglTFRuntimeTaskScheduler::Enqueue(const uint64 OwnerId, TFunction<void()> Work, TFunction<void()> OnCancelled, const EglTFRuntimeTaskPriority Priority)
+{
+	TSharedRef<FglTFRuntimeTask> Task = MakeShared<FglTFRuntimeTask>();
+	Task->OwnerId = OwnerId;
+	Task->Work = MoveTemp(Work);
+	Task->OnCancelled = MoveTemp(OnCancelled);
+
+	bool bAccepted = false;
+	TArray<TSharedRef<FglTFRuntimeTask>> ReadyTasks;
+	{
+		FScopeLock Lock(&TasksLock);
+		if (ThreadPool)
+		{
+			PendingTasks[(int32)Priority].Add(Task);
+			Dispatch(ReadyTasks);
+			bAccepted = true;
+		}
+	}
+
+	// not started or already shut down
+	if (!bAccepted)
+	{
+		if (Task->OnCancelled)
+		{
+			Task->OnCancelled();
+		}
+		return;
+	}
+
+	Launch(ReadyTasks);
+}
+
+int32 FglTFRuntimeTaskScheduler::Cancel(const uint64 OwnerId)
+{
+	if (OwnerId == 0)
+	{
+		return 0;
+	}
+
+	TArray<TSharedRef<FglTFRuntimeTask>> CancelledTasks;
+	{
+		FScopeLock Lock(&TasksLock);
+		for (TArray<TSharedRef<FglTFRuntimeTask>>& Tasks : PendingTasks)
+		{
+			for (int32 TaskIndex = Tasks.Num() - 1; TaskIndex >= 0; TaskIndex--)
+			{
+				if (Tasks[TaskIndex]->OwnerId == OwnerId)
+				{
+					CancelledTasks.Add(Tasks[TaskIndex]);
+					Tasks.RemoveAt(TaskIndex);
+				}
+			}
+		}
+	}
+
+	// callbacks are triggered outside of the lock
+	for (const TSharedRef<FglTFRuntimeTask>& Task : CancelledTasks)
+	{
+		if (Task->OnCancelled)
+		{
+			Task->OnCancelled();
+		}
+	}
+
+	return CancelledTasks.Num();
+}
+
+void FglTFRuntimeTaskScheduler::SetMaxConcurrency(const int32 InMaxConcurrency)
+{
+	CVarglTFRuntimeMaxConcurrentAsyncTasks->Set(FMath::Max(0, InMaxConcurrency), ECVF_SetByCode);
+
+	TArray<TSharedRef<FglTFRuntimeTask>> ReadyTasks;
+	{
+		FScopeLock Lock(&TasksLock);
+		Dispatch(ReadyTasks);
+	}
+	Launch(ReadyTasks);
+}
+
+int32 FglTFRuntimeTaskScheduler::GetMaxConcurrency() const
+{
+	const int32 PoolConcurrency = FMath::Max(1, NumPoolThreads);
+	const int32 MaxConcurrency = CVarglTFRuntimeMaxConcurrentAsyncTasks.GetValueOnAnyThread();
+	if (MaxConcurrency > 0)
+	{
+		return FMath::Min(MaxConcurrency, PoolConcurrency);
+	}
+	return PoolConcurrency;
+}
+
+int32 FglTFRuntimeTaskScheduler::GetNumPending() const
+{
+	FScopeLock Lock(&TasksLock);
+	int32 NumPending = 0;
+	for (const TArray<TSharedRef<FglTFRuntimeTask>>& Tasks : PendingTasks)
+	{
+		NumPending += Tasks.Num();
+	}
+	return NumPending;
+}
+
+int32 FglTFRuntimeTaskScheduler::GetNumRunning() const
+{
+	FScopeLock Lock(&TasksLock);
+	return NumRunning;
+}
+
+void FglTFRuntimeTaskScheduler::Dispatch(TArray<TSharedRef<FglTFRuntimeTask>>& OutTasks)
+{
+	if (!ThreadPool)
+	{
+		return;
+	}
+
+	const int32 CurrentMaxConcurrency = GetMaxConcurrency();
+
+	for (TArray<TSharedRef<FglTFRuntimeTask>>& Tasks : PendingTasks)
+	{
+		while (NumRunning < CurrentMaxConcurrency && Tasks.Num() > 0)
+		{
+			// FIFO within the same priority
+			OutTasks.Add(Tasks[0]);
+			Tasks.RemoveAt(0, 1, false);
+			NumRunning++;
+		}
+	}
+}
+
+void FglTFRuntimeTaskScheduler::Launch(const TArray<TSharedRef<FglTFRuntimeTask>>& Tasks)
+{
+	TArray<TSharedRef<FglTFRuntimeTask>> CancelledTasks;
+	{
+		// queueing never runs the task, holding the lock ensures the pool is not destroyed meanwhile
+		FScopeLock Lock(&TasksLock);
+		for (const TSharedRef<FglTFRuntimeTask>& Task : Tasks)
+		{
+			if (!ThreadPool)
+			{
+				CancelledTasks.Add(Task);
+				NumRunning--;
+				continue;
+			}
+
+			AsyncPool(*ThreadPool, [this, Task]()
+				{
+					Task->Work();
+					OnTaskCompleted();
+				});
+		}
+	}
+
+	for (const TSharedRef<FglTFRuntimeTask>& Task : CancelledTasks)
+	{
+		if (Task->OnCancelled)
+		{
+			Task->OnCancelled();
+		}
+	}
+}
+
+void FglTFRuntimeTaskScheduler::OnTaskCompleted()
+{
+	TArray<TSharedRef<FglTFRuntimeTask>> ReadyTasks;
+	{
+		FScopeLock Lock(&TasksLock);
+		NumRunning--;
+		Dispatch(ReadyTasks);
+	}
+	Launch(ReadyTasks);
+}
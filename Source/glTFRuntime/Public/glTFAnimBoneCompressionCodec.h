@@ -20,6 +20,9 @@ public:
 	
 	TArray<FRawAnimSequenceTrack> Tracks;
 
+	// builds the frame interleaved copy of Tracks used by DecompressPose (call it after changing Tracks)
+	void BuildPoseTracks();
+
 protected:
 	float TimeToIndex(
 		float SequenceLength,
@@ -32,4 +35,12 @@ protected:
 	FQuat GetTrackRotation(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const;
 	FVector GetTrackLocation(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const;
 	FVector GetTrackScale(FAnimSequenceDecompressionContext& DecompContext, const int32 TrackIndex) const;
+
+	// keys are stored frame by frame, each frame has a block for every component (all of the X, then all of the Y...)
+	TArray<float> PoseRotations;
+	TArray<float> PoseLocations;
+	TArray<float> PoseScales;
+	int32 PoseNumTracks = 0;
+	// 0 when the tracks cannot be interleaved (different number of keys)
+	int32 PoseNumKeys = 0;
 };
@@ -7,6 +7,28 @@
 #include "glTFRuntimeAsset.h"
 #include "glTFRuntimeAssetActorAsync.generated.h"
 
+class AglTFRuntimeAssetActorAsync;
+
+// a single mesh (and skin) load shared by all of the components using it
+UCLASS()
+class GLTFRUNTIME_API UglTFRuntimeAssetActorAsyncMeshRequest : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	int32 MeshIndex;
+	int32 SkinIndex;
+
+	UPROPERTY()
+	TArray<UPrimitiveComponent*> Components;
+
+	UFUNCTION()
+	void OnStaticMeshLoaded(UStaticMesh* StaticMesh);
+
+	UFUNCTION()
+	void OnSkeletalMeshLoaded(USkeletalMesh* SkeletalMesh);
+};
+
 UCLASS()
 class GLTFRUNTIME_API AglTFRuntimeAssetActorAsync : public AActor
 {
@@ -51,22 +73,29 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
 	bool bShowWhileLoading;
 
+	// max number of meshes loaded at the same time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
+	int32 MaxConcurrentMeshLoads;
+
+	void OnStaticMeshRequestLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, UStaticMesh* StaticMesh);
+	void OnSkeletalMeshRequestLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest, USkeletalMesh* SkeletalMesh);
+
 private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"), Category="glTFRuntime")
 	USceneComponent* AssetRoot;
 
 	TMap<UPrimitiveComponent*, FglTFRuntimeNode> MeshesToLoad;
 
-	void LoadNextMeshAsync();
+	// requests are deduplicated by mesh (and skin) index
+	UPROPERTY()
+	TArray<UglTFRuntimeAssetActorAsyncMeshRequest*> PendingMeshRequests;
 
-	UFUNCTION()
-	void LoadStaticMeshAsync(UStaticMesh* StaticMesh);
+	UPROPERTY()
+	TArray<UglTFRuntimeAssetActorAsyncMeshRequest*> RunningMeshRequests;
 
-	UFUNCTION()
-	void LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh);
+	void LoadNextMeshAsync();
 
-	// this is safe to share between game and async threads because everything is sequential
-	UPrimitiveComponent* CurrentPrimitiveComponent;
+	void MeshRequestCompleted(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest);
 
 	double LoadingStartTime;
 
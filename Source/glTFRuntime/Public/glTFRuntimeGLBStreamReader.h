@@ -0,0 +1,61 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeParser.h"
+
+DECLARE_DELEGATE_OneParam(FglTFRuntimeGLBStreamOnParserReady, TSharedRef<FglTFRuntimeParser>);
+
+/*
+* Incremental GLB reader: the parser is built as soon as the JSON chunk is available,
+* the BIN chunk is streamed into the parser while it arrives (buffer views not yet received are waited for
+* by the loading threads).
+* Non GLB content (gltf, gzip, zip) is collected and parsed in Finish().
+*/
+class GLTFRUNTIME_API FglTFRuntimeGLBStreamReader
+{
+public:
+	FglTFRuntimeGLBStreamReader(const FglTFRuntimeConfig& InLoaderConfig);
+
+	bool Feed(const uint8* Data, const int64 Num);
+	bool FeedFromFile(const FString& Filename, const int64 ReadChunkSize = 1024 * 1024);
+	bool Finish();
+	// the stream will not be completed, pending loads waiting for the BIN chunk fail
+	void Abort();
+
+	bool IsJsonReady() const { return Parser.IsValid(); }
+	bool HasError() const { return bError; }
+
+	TSharedPtr<FglTFRuntimeParser> GetParser() const { return Parser; }
+
+	FglTFRuntimeGLBStreamOnParserReady OnParserReady;
+
+protected:
+	enum class EState : uint8
+	{
+		Header,
+		ChunkHeader,
+		ChunkBody
+	};
+
+	bool EndChunk();
+	bool SetError(const FString& Message);
+	void PublishParser();
+
+	FglTFRuntimeConfig LoaderConfig;
+	TSharedPtr<FglTFRuntimeParser> Parser;
+
+	EState State;
+	TArray<uint8, TFixedAllocator<12>> HeaderData;
+	TArray64<uint8> JsonData;
+	TArray64<uint8> FallbackData;
+
+	int64 ChunkRemaining;
+	bool bCollectingJson;
+	bool bStreamingBinary;
+	bool bBinaryFound;
+	bool bFallback;
+	bool bError;
+	bool bParserPending;
+};
@@ -0,0 +1,106 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+struct FglTFRuntimeStageStats
+{
+	int32 Count = 0;
+	double TotalSeconds = 0;
+	double MaxSeconds = 0;
+};
+
+/*
+* Continuations scheduled by the async workers: workers enqueue the game thread step and return,
+* the queue is consumed by the core ticker under a per-frame milliseconds budget.
+* The budget is global, driven by the glTFRuntime.GameThreadFrameBudgetMs console variable
+* (can be set in the project config, [ConsoleVariables] section of DefaultEngine.ini).
+*/
+class GLTFRUNTIME_API FglTFRuntimeGameThreadQueue
+{
+public:
+	static FglTFRuntimeGameThreadQueue& Get();
+
+	// can be called from any thread, tasks enqueued after Shutdown() are discarded
+	void Enqueue(TFunction<void()> Task);
+
+	// for short steps whose result is required by the worker (materials...), they run before the other tasks,
+	// returns false if the task has been cancelled by Shutdown() (the worker is released without running it)
+	bool EnqueueAndWait(TFunction<void()> Task);
+
+	// the task runs a single step per call and is requeued (at the end) until it returns true,
+	// this allows long operations (like meshes finalization) to be spread over multiple frames
+	void EnqueueResumable(TFunction<bool()> Task);
+
+	// at least one task is always executed per frame, 0 means no budget, can be called from any thread
+	void SetFrameBudgetMs(const float InFrameBudgetMs);
+	float GetFrameBudgetMs() const { return FrameBudgetUs.GetValue() / 1000.0f; }
+
+	int32 GetNumPending() const { return NumPending.GetValue(); }
+
+	// time spent in each (named) game thread stage, can be called from any thread.
+	// glTFRuntime.DumpStageStats logs them, glTFRuntime.ResetStageStats resets them
+	void AddStageStats(const FName Stage, const double Seconds);
+	TMap<FName, FglTFRuntimeStageStats> GetStageStats() const;
+	void ResetStageStats();
+
+	// called by the module, Shutdown() cancels the pending tasks and releases the waiting workers
+	void Startup();
+	void Shutdown();
+
+protected:
+	FglTFRuntimeGameThreadQueue();
+
+	bool Tick(float DeltaTime);
+
+	struct FWaitingTask
+	{
+		TFunction<void()>* Task;
+		FEvent* CompletionEvent;
+		bool* bExecuted;
+	};
+
+	TQueue<FWaitingTask, EQueueMode::Mpsc> HighPriorityTasks;
+	TQueue<TFunction<void()>, EQueueMode::Mpsc> Tasks;
+	FThreadSafeCounter NumPending;
+	// microseconds, so that it can be atomically updated from any thread
+	FThreadSafeCounter FrameBudgetUs;
+
+	// serializes the enqueueing with Startup()/Shutdown(), so that no task can be queued after the final drain
+	FCriticalSection StateLock;
+	FThreadSafeBool bStarted;
+	FThreadSafeBool bShutdown;
+
+	mutable FCriticalSection StageStatsLock;
+	TMap<FName, FglTFRuntimeStageStats> StageStats;
+
+	// game thread only
+#if ENGINE_MAJOR_VERSION >= 5
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+};
+
+struct FglTFRuntimeScopedStageStats
+{
+	FglTFRuntimeScopedStageStats(const FName InStage) : Stage(InStage), StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	~FglTFRuntimeScopedStageStats()
+	{
+		FglTFRuntimeGameThreadQueue::Get().AddStageStats(Stage, FPlatformTime::Seconds() - StartTime);
+	}
+
+	const FName Stage;
+	const double StartTime;
+};
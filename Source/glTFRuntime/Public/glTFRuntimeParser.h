@@ -21,6 +21,13 @@
 #if WITH_EDITOR
 #include "Rendering/SkeletalMeshLODImporterData.h"
 #endif
+#include "Async/Future.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/IntegralConstant.h"
 #include "Serialization/ArrayReader.h"
 #include "UObject/Package.h"
 #include "glTFRuntimeParser.generated.h"
@@ -49,6 +56,23 @@ struct FglTFRuntimeBlob
 	}
 };
 
+/*
+* Owns a memory mapped file, blobs can point
+* directly into its region as long as the parser is alive
+*/
+struct FglTFRuntimeMappedFile
+{
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+
+	~FglTFRuntimeMappedFile()
+	{
+		// regions must be released before their handle
+		Region.Reset();
+		Handle.Reset();
+	}
+};
+
 UENUM()
 enum class EglTFRuntimeTransformBaseType : uint8
 {
@@ -168,6 +192,12 @@ struct FglTFRuntimeConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FString PrefixForUnnamedNodes;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bUseMappedFile;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bPrefetchArchiveEntries;
+
 	FglTFRuntimeConfig()
 	{
 		TransformBaseType = EglTFRuntimeTransformBaseType::Default;
@@ -181,6 +211,8 @@ struct FglTFRuntimeConfig
 		RuntimeContextObject = nullptr;
 		bAsBlob = false;
 		PrefixForUnnamedNodes = "node";
+		bUseMappedFile = false;
+		bPrefetchArchiveEntries = false;
 	}
 
 	FMatrix GetMatrix() const
@@ -483,6 +515,31 @@ struct FglTFRuntimeMaterialsConfig
 	}
 };
 
+USTRUCT(BlueprintType)
+struct FglTFRuntimeLODGenerationConfig
+{
+	GENERATED_BODY()
+
+	// fraction of the LOD0 triangles to keep
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float TriangleRatio;
+
+	// max simplification error (relative to the mesh extent)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float MaxError;
+
+	// normals and uvs differences contribution to the error
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float AttributesWeight;
+
+	FglTFRuntimeLODGenerationConfig()
+	{
+		TriangleRatio = 0.5f;
+		MaxError = 0.01f;
+		AttributesWeight = 0.01f;
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeStaticMeshConfig
 {
@@ -548,6 +605,22 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bBuildNavCollision;
 
+	// reorder triangles for the post-transform vertex cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexCache;
+
+	// reorder (vertex cache optimized) triangle clusters to reduce overdraw
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeOverdraw;
+
+	// reorder vertices in triangles order
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexFetch;
+
+	// LODs generated (from LOD0) by mesh simplification when the asset has a single LOD
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	TArray<FglTFRuntimeLODGenerationConfig> GeneratedLODs;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TMap<FString, FString> CustomConfigMap;
 
@@ -583,6 +656,9 @@ struct FglTFRuntimeStaticMeshConfig
 		bUseHighPrecisionUVs = false;
 		bGenerateStaticMeshDescription = false;
 		bBuildNavCollision = false;
+		bOptimizeVertexCache = false;
+		bOptimizeOverdraw = false;
+		bOptimizeVertexFetch = false;
 	}
 };
 
@@ -794,6 +870,14 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	int32 OverrideSkinIndex;
 
+	// maximum number of bone influences per vertex (usually 4, 8 or 12, clamped to the engine limit)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxBoneInfluences;
+
+	// bone influences with a weight below this value are dropped (the remaining ones are renormalized)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float BoneInfluencesWeightThreshold;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeSkeletonConfig SkeletonConfig;
 
@@ -833,6 +917,10 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	EglTFRuntimeMorphTargetsDuplicateStrategy MorphTargetsDuplicateStrategy;
 
+	// morph target deltas with all of the components below this value are not stored
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float MorphTargetsDeltaThreshold;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FVector ShiftBounds;
 
@@ -861,6 +949,8 @@ struct FglTFRuntimeSkeletalMeshConfig
 		Skeleton = nullptr;
 		bIgnoreSkin = false;
 		OverrideSkinIndex = -1;
+		MaxBoneInfluences = 12;
+		BoneInfluencesWeightThreshold = KINDA_SMALL_NUMBER;
 		BoundsScale = FVector::OneVector;
 		bShiftBoundsByRootBone = false;
 		bIgnoreMissingBones = false;
@@ -870,6 +960,7 @@ struct FglTFRuntimeSkeletalMeshConfig
 		bDisableMorphTargets = false;
 		bIgnoreEmptyMorphTargets = true;
 		MorphTargetsDuplicateStrategy = EglTFRuntimeMorphTargetsDuplicateStrategy::Ignore;
+		MorphTargetsDeltaThreshold = KINDA_SMALL_NUMBER;
 		ShiftBounds = FVector::ZeroVector;
 		bUseHighPrecisionUVs = false;
 		PhysicsAssetTemplate = nullptr;
@@ -1095,6 +1186,9 @@ struct FglTFRuntimeSkeletalMeshLOD
 
 #if WITH_EDITOR
 	FSkeletalMeshImportData ImportData;
+#else
+	// source (primitive) vertex index of each render vertex
+	TArray<uint32> SourceVertices;
 #endif
 
 	FglTFRuntimeSkeletalMeshLOD() = delete;
@@ -1107,6 +1201,15 @@ struct FglTFRuntimeSkeletalMeshLOD
 	}
 };
 
+enum class EglTFRuntimeSkeletalMeshFinalizeStage : uint8
+{
+	LODs,
+	Skeleton,
+	Physics,
+	PostLoad,
+	Completed
+};
+
 struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 {
 	TSharedRef<class FglTFRuntimeParser> Parser;
@@ -1124,6 +1227,12 @@ struct FglTFRuntimeSkeletalMeshContext : public FGCObject
 	// here we cache per-context LODs
 	TArray<FglTFRuntimeMeshLOD> CachedRuntimeMeshLODs;
 
+	// resumable finalization state
+	EglTFRuntimeSkeletalMeshFinalizeStage FinalizeStage = EglTFRuntimeSkeletalMeshFinalizeStage::LODs;
+	int32 FinalizeLODIndex = 0;
+	bool bHasMorphTargets = false;
+	int32 MorphTargetIndex = 0;
+
 	FglTFRuntimeSkeletalMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const FglTFRuntimeSkeletalMeshConfig& InSkeletalMeshConfig) : Parser(InParser), SkeletalMeshConfig(InSkeletalMeshConfig)
 	{
 		EObjectFlags Flags = RF_Public;
@@ -1180,11 +1289,24 @@ struct FglTFRuntimeMeshLOD
 	TArray<FglTFRuntimePrimitive> Primitives;
 	TArray<FTransform> AdditionalTransforms;
 
+	// generated (simplified) LODs: Primitives only hold the indices, the attributes are read from this LOD
+	const FglTFRuntimeMeshLOD* SharedAttributesLOD;
+
 	FglTFRuntimeMeshLOD()
 	{
+		SharedAttributesLOD = nullptr;
 	}
 };
 
+enum class EglTFRuntimeStaticMeshFinalizeStage : uint8
+{
+	Resources,
+	Collision,
+	Sockets,
+	Navigation,
+	Completed
+};
+
 struct FglTFRuntimeStaticMeshContext : public FGCObject
 {
 	TSharedRef<class FglTFRuntimeParser> Parser;
@@ -1201,6 +1323,15 @@ struct FglTFRuntimeStaticMeshContext : public FGCObject
 
 	TMap<FString, FTransform> AdditionalSockets;
 
+	// here we cache per-context LODs
+	TArray<FglTFRuntimeMeshLOD> CachedRuntimeMeshLODs;
+
+	// simplified LODs (stable pointers, LODs references them)
+	TArray<TUniquePtr<FglTFRuntimeMeshLOD>> GeneratedRuntimeMeshLODs;
+
+	// resumable finalization state
+	EglTFRuntimeStaticMeshFinalizeStage FinalizeStage = EglTFRuntimeStaticMeshFinalizeStage::Resources;
+
 	FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const FglTFRuntimeStaticMeshConfig& InStaticMeshConfig);
 
 	FString GetReferencerName() const override
@@ -1393,20 +1524,143 @@ struct FglTFRuntimeMaterial
 	}
 };
 
+enum class EglTFRuntimeRootArray : uint8
+{
+	Nodes,
+	Meshes,
+	Materials,
+	Textures,
+	Samplers,
+	Accessors,
+	BufferViews,
+	Images,
+	Skins,
+	Animations,
+	Scenes,
+	Cameras,
+	Num
+};
+
+/*
+* Flat, index addressable view of the glTF document, built once after parsing.
+* Used by the buffers/accessors hot paths instead of string keyed json lookups.
+*/
+struct FglTFRuntimeDocument
+{
+	TArray<int64> BuffersByteLength;
+	// uris are read from the json on first access (data uris can be huge)
+
+	TArray<int32> BufferViewsBuffer;
+	TArray<int64> BufferViewsByteOffset;
+	TArray<int64> BufferViewsByteLength;
+	TArray<int64> BufferViewsByteStride;
+	TArray<bool> BufferViewsCompressed;
+
+	TArray<int32> AccessorsBufferView;
+	TArray<int64> AccessorsByteOffset;
+	TArray<int64> AccessorsComponentType;
+	TArray<int64> AccessorsCount;
+	TArray<int64> AccessorsElements;
+	TArray<bool> AccessorsNormalized;
+	TArray<bool> AccessorsSparse;
+
+	// root arrays addressed by EglTFRuntimeRootArray (no string hashing on lookup)
+	TArray<TSharedPtr<FJsonObject>> RootObjects[static_cast<int32>(EglTFRuntimeRootArray::Num)];
+	bool bHasRootObjects = false;
+
+	void Reset()
+	{
+		*this = FglTFRuntimeDocument();
+	}
+};
+
+/*
+* Read only content of an archive entry: either shared inflated data or a view of a stored entry.
+* Stored entries point into the archive memory, so they are valid as long as the zip file.
+*/
+struct FglTFRuntimeZipEntryContent
+{
+	const uint8* Data = nullptr;
+	int64 Num = 0;
+	TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Owner;
+};
+
 class FglTFRuntimeZipFile
 {
 public:
-	bool FromData(const uint8* DataPtr, const int64 DataNum);
+	~FglTFRuntimeZipFile();
 
+	bool FromData(const uint8* DataPtr, const int64 DataNum);
+	bool FromData(TArray64<uint8>&& InData);
+	// no copy, the memory is kept alive by the mapped file
+	bool FromDataView(const uint8* DataPtr, const int64 DataNum, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile);
+
+	/*
+	* No copy, inflated entries are shared with the cache.
+	* An entry bigger than CacheMaxSize is not cached, only the last requested one is kept
+	* (the returned content owns its memory in any case).
+	*/
+	bool GetFileContent(const FString& Filename, FglTFRuntimeZipEntryContent& OutContent);
+	// appends a copy of the entry to OutData
 	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData);
 
 	bool FileExists(const FString& Filename) const;
 
 	FString GetFirstFilenameByExtension(const FString& Extension) const;
 
+	void SetCacheMaxSize(const int64 InCacheMaxSize) { FScopeLock Lock(&CacheLock); CacheMaxSize = InCacheMaxSize; }
+
+	/*
+	* Inflate the specified entries in the thread pool, does not block the caller.
+	* Results go straight to the cache (entries not fitting in CacheMaxSize are skipped),
+	* GetFileContent() waits for an entry being inflated instead of inflating it again,
+	* while an entry whose task has not started yet is taken over (never waiting for a queued pool task).
+	*/
+	void Prefetch(const TArray<FString>& Filenames);
+
+	static bool Inflate(const uint8* Source, const int64 SourceNum, uint8* Dest, const int64 DestNum);
+
 protected:
-	TMap<FString, uint32> OffsetsMap;
-	FArrayReader Data;
+	struct FEntry
+	{
+		uint64 LocalHeaderOffset;
+		uint64 CompressedSize;
+		uint64 UncompressedSize;
+		uint16 Compression;
+	};
+
+	bool ParseCentralDirectory();
+	const uint8* GetEntryData(const FEntry& Entry) const;
+	// CacheLock must be held
+	void AddToCache(const FString& Filename, const TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>& Content);
+
+	TMap<FString, FEntry> EntriesMap;
+
+	TArray64<uint8> OwnedData;
+	const uint8* Data = nullptr;
+	int64 DataNum = 0;
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile;
+
+	// decompressed entries, oldest are evicted first
+	TMap<FString, TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe>> Cache;
+	TArray<FString> CacheOrder;
+	int64 CacheSize = 0;
+	int64 CacheMaxSize = 128 * 1024 * 1024;
+	// the most recent entry not fitting in CacheMaxSize
+	FString OversizeFilename;
+	TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> OversizeContent;
+
+	// entries being inflated by Prefetch(), the flags are guarded by CacheLock
+	struct FPrefetch
+	{
+		bool bStarted = false;
+		// taken over by GetFileContent() before the task started, the task does nothing
+		bool bClaimed = false;
+		TSharedFuture<bool> Future;
+	};
+	TMap<FString, TSharedRef<FPrefetch, ESPMode::ThreadSafe>> Prefetching;
+	// protects the cache (oversize entry included) and Prefetching, entries are inflated outside of it
+	FCriticalSection CacheLock;
 };
 
 USTRUCT(BlueprintType)
@@ -1456,6 +1710,145 @@ struct FglTFRuntimeAudioConfig
 	}
 };
 
+// accessor component conversion, resolved at compile time by the decode plans
+template<typename SourceType, bool bNormalized>
+struct TglTFRuntimeAccessorComponent
+{
+	static FORCEINLINE SourceType Decode(const SourceType Value) { return Value; }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<int8, true>
+{
+	static FORCEINLINE float Decode(const int8 Value) { return FMath::Max(((float)Value) / 127.f, -1.f); }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<uint8, true>
+{
+	static FORCEINLINE float Decode(const uint8 Value) { return ((float)Value) / 255.f; }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<int16, true>
+{
+	static FORCEINLINE float Decode(const int16 Value) { return FMath::Max(((float)Value) / 32767.f, -1.f); }
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<uint16, true>
+{
+	static FORCEINLINE float Decode(const uint16 Value) { return ((float)Value) / 65535.f; }
+};
+
+template<typename T>
+struct TglTFRuntimeAccessorDecodePlan
+{
+	typedef void(*FKernel)(const uint8* Source, const int64 Stride, const int64 Elements, T* Destination, const int64 Count);
+
+	// vector kernel, the number of elements is known at compile time
+	template<typename SourceType, int32 NumElements, bool bNormalized>
+	static void DecodeVector(const uint8* Source, const int64 Stride, const int64 Elements, T* Destination, const int64 Count)
+	{
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const SourceType* Ptr = reinterpret_cast<const SourceType*>(Source + ElementIndex * Stride);
+			T Value;
+			for (int32 i = 0; i < NumElements; i++)
+			{
+				Value[i] = TglTFRuntimeAccessorComponent<SourceType, bNormalized>::Decode(Ptr[i]);
+			}
+			Destination[ElementIndex] = Value;
+		}
+	}
+
+	// vector kernel for unusual number of elements
+	template<typename SourceType, bool bNormalized>
+	static void DecodeVectorGeneric(const uint8* Source, const int64 Stride, const int64 Elements, T* Destination, const int64 Count)
+	{
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const SourceType* Ptr = reinterpret_cast<const SourceType*>(Source + ElementIndex * Stride);
+			T Value;
+			for (int32 i = 0; i < Elements; i++)
+			{
+				Value[i] = TglTFRuntimeAccessorComponent<SourceType, bNormalized>::Decode(Ptr[i]);
+			}
+			Destination[ElementIndex] = Value;
+		}
+	}
+
+	template<typename SourceType, bool bNormalized>
+	static void DecodeScalar(const uint8* Source, const int64 Stride, const int64 Elements, T* Destination, const int64 Count)
+	{
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			Destination[ElementIndex] = TglTFRuntimeAccessorComponent<SourceType, bNormalized>::Decode(*reinterpret_cast<const SourceType*>(Source + ElementIndex * Stride));
+		}
+	}
+
+	template<typename SourceType, bool bNormalized>
+	static FKernel GetVectorKernel(const int64 Elements)
+	{
+		switch (Elements)
+		{
+		case 1:
+			return &DecodeVector<SourceType, 1, bNormalized>;
+		case 2:
+			return &DecodeVector<SourceType, 2, bNormalized>;
+		case 3:
+			return &DecodeVector<SourceType, 3, bNormalized>;
+		case 4:
+			return &DecodeVector<SourceType, 4, bNormalized>;
+		default:
+			return &DecodeVectorGeneric<SourceType, bNormalized>;
+		}
+	}
+
+	static FKernel GetVectorKernel(const int64 ComponentType, const int64 Elements, const bool bNormalized)
+	{
+		switch (ComponentType)
+		{
+		case 5126:
+			return GetVectorKernel<float, false>(Elements);
+		case 5120:
+			return bNormalized ? GetVectorKernel<int8, true>(Elements) : GetVectorKernel<int8, false>(Elements);
+		case 5121:
+			return bNormalized ? GetVectorKernel<uint8, true>(Elements) : GetVectorKernel<uint8, false>(Elements);
+		case 5122:
+			return bNormalized ? GetVectorKernel<int16, true>(Elements) : GetVectorKernel<int16, false>(Elements);
+		case 5123:
+			return bNormalized ? GetVectorKernel<uint16, true>(Elements) : GetVectorKernel<uint16, false>(Elements);
+		default:
+			return nullptr;
+		}
+	}
+
+	static FKernel GetKernel(const int64 ComponentType, const int64 Elements, const bool bNormalized, TIntegralConstant<bool, false>)
+	{
+		return GetVectorKernel(ComponentType, Elements, bNormalized);
+	}
+
+	static FKernel GetKernel(const int64 ComponentType, const int64 Elements, const bool bNormalized, TIntegralConstant<bool, true>)
+	{
+		switch (ComponentType)
+		{
+		case 5126:
+			return &DecodeScalar<float, false>;
+		case 5120:
+			return bNormalized ? &DecodeScalar<int8, true> : &DecodeScalar<int8, false>;
+		case 5121:
+			return bNormalized ? &DecodeScalar<uint8, true> : &DecodeScalar<uint8, false>;
+		case 5122:
+			return bNormalized ? &DecodeScalar<int16, true> : &DecodeScalar<int16, false>;
+		case 5123:
+			return bNormalized ? &DecodeScalar<uint16, true> : &DecodeScalar<uint16, false>;
+		default:
+			return nullptr;
+		}
+	}
+};
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeStaticMeshAsync, UStaticMesh*, StaticMesh);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeSkeletalMeshAsync, USkeletalMesh*, SkeletalMesh);
 
@@ -1478,9 +1871,14 @@ public:
 	FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale);
 
 	static TSharedPtr<FglTFRuntimeParser> FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig);
-	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
-	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromJsonBytes(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
+
+	static TSharedPtr<FJsonObject> ParseJsonBytes(const uint8* DataPtr, int64 DataNum);
+	static bool InflateGzip(const uint8* Source, const int64 SourceNum, TFunctionRef<bool(const uint8*, const int64)> Consumer);
 
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InZipFile); }
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray64<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InZipFile); }
@@ -1553,6 +1951,9 @@ public:
 
 	bool ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes);
 
+	void PrefetchArchiveEntries();
+	static bool DecodeBase64(const TCHAR* Source, int64 SourceLength, TArray64<uint8>& Bytes);
+
 	FString GetReferencerName() const override
 	{
 		return "FglTFRuntimeParser_Referencer";
@@ -1581,14 +1982,36 @@ public:
 	void SetBinaryBuffer(const TArray64<uint8>& InBinaryBuffer)
 	{
 		BinaryBuffer = InBinaryBuffer;
+		BinaryBufferView = FglTFRuntimeBlob();
+	}
+
+	// the memory must be kept alive by the caller (see MappedFile)
+	void SetBinaryBufferView(const uint8* Data, const int64 Num)
+	{
+		BinaryBuffer.Empty();
+		BinaryBufferView.Data = const_cast<uint8*>(Data);
+		BinaryBufferView.Num = Num;
 	}
 
+	// the binary buffer is filled incrementally, buffer views wait for their range to be available.
+	// Must be called before the parser is shared with other threads.
+	void StartBinaryBufferStream(const int64 Size);
+	bool AppendBinaryBufferStream(const uint8* Data, const int64 Num);
+	// wakes up (and fails) the loads waiting for data that will never arrive
+	void AbortBinaryBufferStream();
+
+	bool IsBinaryBufferComplete() const { return BinaryBufferStreamReceived.GetValue() >= BinaryBufferStreamSize; }
+
 	bool LoadStaticMeshIntoProceduralMeshComponent(const int32 MeshIndex, UProceduralMeshComponent* ProceduralMeshComponent, const FglTFRuntimeProceduralMeshConfig& ProceduralMeshConfig);
 
 	USkeletalMesh* FinalizeSkeletalMeshWithLODs(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
 
 	UStaticMesh* FinalizeStaticMesh(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
 
+	// run the next finalization stage, returns true when the mesh is completed (or failed)
+	bool FinalizeSkeletalMeshStage(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext);
+	bool FinalizeStaticMeshStage(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
+
 	TSharedPtr<FJsonValue> GetJSONObjectFromRelativePath(TSharedRef<FJsonObject> JsonObject, const TArray<FglTFRuntimePathItem>& Path) const;
 	TSharedPtr<FJsonValue> GetJSONObjectFromPath(const TArray<FglTFRuntimePathItem>& Path) const;
 
@@ -1621,6 +2044,18 @@ public:
 
 	TSharedPtr<FJsonObject> GetJsonRoot() const { return Root; }
 
+	// must be called if the json root is modified after the parser creation
+	void BuildDocument();
+	const FglTFRuntimeDocument& GetDocument() const { return Document; }
+
+	// cancel the async loads of this parser not yet started (callbacks are triggered with nullptr)
+	int32 CancelAsyncLoads();
+
+	// batch conversion of attributes to the scene basis
+	void TransformPositions(TArray<FVector>& Positions) const;
+	void TransformNormals(TArray<FVector>& Normals) const;
+	void TransformTangents(TArray<FVector4>& Tangents) const;
+
 	static FVector4 CubicSpline(const float TC, const float T0, const float T1, const FVector4 Value0, const FVector4 OutTangent, const FVector4 Value1, const FVector4 InTangent);
 
 	UAnimSequence* CreateAnimationFromPose(USkeletalMesh* SkeletalMesh, const int32 SkinIndex, const FglTFRuntimeSkeletalAnimationConfig& SkeletalAnimationConfig);
@@ -1644,7 +2079,8 @@ public:
 	static FglTFRuntimeOnLoadedTexturePixels OnLoadedTexturePixels;
 	static FglTFRuntimeOnFinalizedStaticMesh OnFinalizedStaticMesh;
 
-	const FglTFRuntimeBlob* GetAdditionalBufferView(const int64 Index, const FString& Name) const;
+	// the blob is copied out under the cache lock, views can be added concurrently
+	bool GetAdditionalBufferView(const int64 Index, const FString& Name, FglTFRuntimeBlob& Blob) const;
 	
 	void AddAdditionalBufferView(const int64 Index, const FString& Name, const FglTFRuntimeBlob& Blob);
 
@@ -1654,12 +2090,16 @@ public:
 		TArray64<uint8> NewArray;
 		NewArray.Append(reinterpret_cast<const uint8*>(Data), Num);
 
-		int32 NewIndex = AdditionalBufferViewsData.Add(MoveTemp(NewArray));
-
 		FglTFRuntimeBlob Blob;
-		Blob.Data = AdditionalBufferViewsData[NewIndex].GetData();
+		Blob.Data = NewArray.GetData();
 		Blob.Num = Num;
 
+		{
+			// moving the array keeps its allocation, so the blob stays valid
+			FScopeLock Lock(&AdditionalBufferViewsCacheLock);
+			AdditionalBufferViewsData.Add(MoveTemp(NewArray));
+		}
+
 		AddAdditionalBufferView(Index, Name, Blob);
 	}
 
@@ -1709,31 +2149,72 @@ public:
 	FVector4 GetJsonObjectVector4(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const FVector4 DefaultValue);
 
 	bool GetRootBoneIndex(TSharedRef<FJsonObject> JsonSkinObject, int64& RootBoneIndex, TArray<int32>& Joints, const FglTFRuntimeSkeletonConfig& SkeletonConfig);
-	TMap<int32, UTexture2D*>& GetTexturesCache();
-	TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD>& GetLODsCache();
+	// snapshot taken under the cache lock, textures can be added concurrently
+	TMap<int32, UTexture2D*> GetTexturesCache();
+	// snapshot taken under the cache lock, LODs can be added concurrently
+	TMap<TSharedRef<FJsonObject>, TSharedRef<FglTFRuntimeMeshLOD>> GetLODsCache();
 
 protected:
 	void LoadAndFillBaseMaterials();
 	TSharedRef<FJsonObject> Root;
+	FglTFRuntimeDocument Document;
 
 	TMap<int32, UStaticMesh*> StaticMeshesCache;
+	FCriticalSection StaticMeshesCacheLock;
 	TMap<int32, UMaterialInterface*> MaterialsCache;
 	TMap<int32, USkeleton*> SkeletonsCache;
 	TMap<int32, USkeletalMesh*> SkeletalMeshesCache;
 	TMap<int32, UTexture2D*> TexturesCache;
+	FCriticalSection TexturesCacheLock;
+
+	/*
+	* Blob caches are publish-on-complete: data is decoded outside of the lock and added once,
+	* entries are never modified or removed, so the returned pointers can be shared between threads.
+	*/
+	bool FindCachedBlob(FCriticalSection& Lock, const TMap<int32, TArray64<uint8>>& Cache, const int32 Index, FglTFRuntimeBlob& Blob, const TMap<int32, int64>* StridesCache = nullptr, int64* Stride = nullptr);
+	void PublishCachedBlob(FCriticalSection& Lock, TMap<int32, TArray64<uint8>>& Cache, const int32 Index, TArray64<uint8>&& Data, FglTFRuntimeBlob& Blob, TMap<int32, int64>* StridesCache = nullptr, int64* Stride = nullptr);
 
 	TMap<int32, TArray64<uint8>> BuffersCache;
+	// buffers living in the zip archive (or in its cache), guarded by BuffersCacheLock
+	TMap<int32, FglTFRuntimeZipEntryContent> ZipBuffersCache;
+	FCriticalSection BuffersCacheLock;
 	TMap<int32, TArray64<uint8>> CompressedBufferViewsCache;
 	TMap<int32, int64> CompressedBufferViewsStridesCache;
+	FCriticalSection CompressedBufferViewsCacheLock;
 
 	TMap<UMaterialInterface*, FString> MaterialsNameCache;
+	// protects MaterialsCache and MaterialsNameCache
+	FCriticalSection MaterialsCacheLock;
 
 	TArray<FglTFRuntimeNode> AllNodesCache;
-	bool bAllNodesCached;
+	FThreadSafeBool bAllNodesCached;
+	FCriticalSection AllNodesCacheLock;
 
-	TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> LODsCache;
+	// LODs are heap allocated so that pointers survive the map growth
+	TMap<TSharedRef<FJsonObject>, TSharedRef<FglTFRuntimeMeshLOD>> LODsCache;
+	FCriticalSection LODsCacheLock;
 
 	TArray64<uint8> BinaryBuffer;
+	FglTFRuntimeBlob BinaryBufferView;
+	// the streamed buffer is allocated upfront and never reallocated, only the received counter changes
+	int64 BinaryBufferStreamSize = 0;
+	FThreadSafeCounter64 BinaryBufferStreamReceived;
+	FThreadSafeBool bBinaryBufferStreamAborted;
+	uint32 BinaryBufferStreamThreadId = 0;
+
+	// loads waiting for a range of the streamed buffer, woken up by the feeder (or by the abort)
+	struct FglTFRuntimeBinaryBufferStreamWaiter
+	{
+		int64 RangeEnd;
+		FEvent* Event;
+	};
+	TArray<FglTFRuntimeBinaryBufferStreamWaiter> BinaryBufferStreamWaiters;
+	FCriticalSection BinaryBufferStreamWaitersLock;
+
+	bool WaitForBinaryBufferRange(const int64 RangeEnd);
+	void WakeUpBinaryBufferStreamWaiters();
+
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile;
 
 	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 
@@ -1767,7 +2248,8 @@ public:
 	bool CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems);
 	bool CheckJsonRootIndex(const FString FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) { return CheckJsonIndex(Root, FieldName, Index, JsonItems); }
 	TSharedPtr<FJsonObject> GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index);
-	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) { return GetJsonObjectFromIndex(Root, FieldName, Index); }
+	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index);
+	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const EglTFRuntimeRootArray RootArray, const int32 Index);
 	TSharedPtr<FJsonObject> GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index);
 	TSharedPtr<FJsonObject> GetJsonObjectFromRootExtensionIndex(const FString& ExtensionName, const FString& FieldName, const int32 Index) { return GetJsonObjectFromExtensionIndex(Root, ExtensionName, FieldName, Index); }
 	TArray<TSharedRef<FJsonObject>> GetJsonObjectArrayFromExtension(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName);
@@ -1801,10 +2283,21 @@ protected:
 	bool CanWriteToCache(const EglTFRuntimeCacheMode CacheMode) { return CacheMode == EglTFRuntimeCacheMode::Write || CacheMode == EglTFRuntimeCacheMode::ReadWrite; }
 
 	bool DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes);
+	// original byte by byte decoder (ATTRIBUTES and TRIANGLES only), the automation tests compare it with the fast one
+	bool DecompressMeshOptimizerReference(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes);
 
 	FMatrix SceneBasis;
 	float SceneScale;
 
+	// identifies the async loads of this parser in the task scheduler
+	const uint64 AsyncTasksOwnerId;
+
+	// SceneBasis as a signed axis permutation (Default, YForward, Identity...)
+	void BuildSceneBasisPermutation();
+	bool bSceneBasisIsPermutation;
+	int32 SceneBasisAxis[3];
+	FVector SceneBasisSign;
+
 	TMap<EglTFRuntimeMaterialType, UMaterialInterface*> MetallicRoughnessMaterialsMap;
 	TMap<EglTFRuntimeMaterialType, UMaterialInterface*> SpecularGlossinessMaterialsMap;
 	TMap<EglTFRuntimeMaterialType, UMaterialInterface*> UnlitMaterialsMap;
@@ -1812,6 +2305,7 @@ protected:
 	TMap<EglTFRuntimeMaterialType, UMaterialInterface*> ClearCoatMaterialsMap;
 
 	TArray<FString> Errors;
+	FCriticalSection ErrorsLock;
 
 	FString BaseDirectory;
 
@@ -1829,8 +2323,8 @@ public:
 		return FTransform(SceneBasis.Inverse() * M * SceneBasis);
 	}
 
-	template<typename T, typename Callback>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter, const int64 AdditionalBufferView)
+	template<typename T, bool bScalar>
+	bool DecodeAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, bool bNormalized, const int64 AdditionalBufferView)
 	{
 		int64 AccessorIndex;
 		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
@@ -1839,9 +2333,11 @@ public:
 		}
 
 		FglTFRuntimeBlob Blob;
+		FglTFRuntimeBlob AdditionalBlob;
+		const bool bHasAdditionalBlob = GetAdditionalBufferView(AdditionalBufferView, Name, AdditionalBlob);
 		int64 ComponentType = 0, Stride = 0, Elements = 0, ElementSize = 0, Count = 0;
 		bool bOverrideNormalized = false;
-		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bOverrideNormalized, Blob, GetAdditionalBufferView(AdditionalBufferView, Name)))
+		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bOverrideNormalized, Blob, bHasAdditionalBlob ? &AdditionalBlob : nullptr))
 		{
 			return false;
 		}
@@ -1861,159 +2357,66 @@ public:
 			return false;
 		}
 
-		Data.AddUninitialized(Count);
-		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		// the kernel is selected once for the whole accessor
+		typename TglTFRuntimeAccessorDecodePlan<T>::FKernel Kernel = TglTFRuntimeAccessorDecodePlan<T>::GetKernel(ComponentType, Elements, bNormalized, TIntegralConstant<bool, bScalar>());
+		if (!Kernel)
 		{
-			int64 Index = ElementIndex * Stride;
-			T Value;
-			// FLOAT
-			if (ComponentType == 5126)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = Ptr[i];
-				}
-			}
-			// BYTE
-			else if (ComponentType == 5120)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 127.f, -1.f) : Ptr[i];
-				}
-
-			}
-			// UNSIGNED_BYTE
-			else if (ComponentType == 5121)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 255.f : Ptr[i];
-				}
-			}
-			// SHORT
-			else if (ComponentType == 5122)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 32767.f, -1.f) : Ptr[i];
-				}
-			}
-			// UNSIGNED_SHORT
-			else if (ComponentType == 5123)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 65535.f : Ptr[i];
-				}
-			}
-			else
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-				return false;
-			}
-
-			Data[ElementIndex] = Filter(Value);
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			return false;
 		}
 
+		const int64 Offset = Data.Num();
+		Data.AddUninitialized(Count);
+		Kernel(Blob.Data, Stride, Elements, Data.GetData() + Offset, Count);
+
 		return true;
 	}
 
 	template<typename T, typename Callback>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter, const int64 AdditionalBufferView)
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter, const int64 AdditionalBufferView)
 	{
-		int64 AccessorIndex;
-		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
+		const int64 Offset = Data.Num();
+		if (!DecodeAccessorField<T, false>(JsonObject, Name, Data, SupportedElements, SupportedTypes, bNormalized, AdditionalBufferView))
 		{
 			return false;
 		}
 
-		FglTFRuntimeBlob Blob;
-		int64 ComponentType, Stride, Elements, ElementSize, Count;
-		bool bOverrideNormalized = false;
-
-		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bOverrideNormalized, Blob, GetAdditionalBufferView(AdditionalBufferView, Name)))
+		for (int64 ElementIndex = Offset; ElementIndex < Data.Num(); ElementIndex++)
 		{
-			return false;
-		}
-
-		if (bOverrideNormalized)
-		{
-			bNormalized = bOverrideNormalized;
+			Data[ElementIndex] = Filter(Data[ElementIndex]);
 		}
 
-		if (Elements != 1)
-		{
-			return false;
-		}
+		return true;
+	}
 
-		if (!SupportedTypes.Contains(ComponentType))
+	template<typename T, typename Callback>
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter, const int64 AdditionalBufferView)
+	{
+		const int64 Offset = Data.Num();
+		if (!DecodeAccessorField<T, true>(JsonObject, Name, Data, { 1 }, SupportedTypes, bNormalized, AdditionalBufferView))
 		{
 			return false;
 		}
 
-		Data.AddUninitialized(Count);
-		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		for (int64 ElementIndex = Offset; ElementIndex < Data.Num(); ElementIndex++)
 		{
-			int64 Index = ElementIndex * Stride;
-			T Value;
-			// FLOAT
-			if (ComponentType == 5126)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				Value = *Ptr;
-			}
-			// BYTE
-			else if (ComponentType == 5120)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 127.f, -1.f) : *Ptr;
-			}
-			// UNSIGNED_BYTE
-			else if (ComponentType == 5121)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 255.f : *Ptr;
-			}
-			// SHORT
-			else if (ComponentType == 5122)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 32767.f, -1.f) : *Ptr;
-			}
-			// UNSIGNED_SHORT
-			else if (ComponentType == 5123)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 65535.f : *Ptr;
-			}
-			else
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-				return false;
-			}
-
-			Data[ElementIndex] = Filter(Value);
+			Data[ElementIndex] = Filter(Data[ElementIndex]);
 		}
 
 		return true;
 	}
 
+	// no filter, the decoded span is used as is
 	template<typename T>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, const bool bNormalized, const int64 AdditionalBufferView)
 	{
-		return BuildFromAccessorField(JsonObject, Name, Data, SupportedElements, SupportedTypes, bNormalized, [&](T InValue) -> T {return InValue; }, AdditionalBufferView);
+		return DecodeAccessorField<T, false>(JsonObject, Name, Data, SupportedElements, SupportedTypes, bNormalized, AdditionalBufferView);
 	}
 
 	template<typename T>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, const bool bNormalized, const int64 AdditionalBufferView)
 	{
-		return BuildFromAccessorField(JsonObject, Name, Data, SupportedTypes, bNormalized, [&](T InValue) -> T {return InValue; }, AdditionalBufferView);
+		return DecodeAccessorField<T, true>(JsonObject, Name, Data, { 1 }, SupportedTypes, bNormalized, AdditionalBufferView);
 	}
 
 
@@ -2037,6 +2440,23 @@ public:
 		return true;
 	}
 
+	// post-transform vertex cache, overdraw and vertex fetch optimizations, indices are in the [0, NumVertices) range
+	static void OptimizeVertexCache(TArray<uint32>& Indices, const int32 NumVertices);
+	static void OptimizeOverdraw(TArray<uint32>& Indices, const TArray<FVector>& Positions);
+	// reorder vertices by first use, returns the number of used vertices (Remap maps old vertices to new ones, INDEX_NONE if unused)
+	static int32 OptimizeVertexFetchRemap(TArray<uint32>& Indices, const int32 NumVertices, TArray<int32>& Remap);
+	static int64 CountVertexCacheMisses(const TArray<uint32>& Indices, const int32 NumVertices, const int32 CacheSize = 16);
+
+	// quadric error edge collapse simplification, returns the reached error (relative to the mesh extent)
+	static float SimplifyIndices(TArray<uint32>& Indices, const TArray<FVector>& Positions, const TArray<FVector>& Normals, const TArray<FVector2D>& UVs, const int32 TargetNumTriangles, const float MaxError, const float AttributesWeight);
+	void GenerateStaticMeshLODs(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext);
+
+	// EXT_meshopt_compression decoders, Destination must contain at least Elements * Stride bytes
+	static bool DecodeMeshoptVertexBuffer(uint8* Destination, const int64 Elements, const int64 Stride, const uint8* Source, const int64 SourceSize);
+	static bool DecodeMeshoptIndexBuffer(uint8* Destination, const int64 Elements, const int64 Stride, const uint8* Source, const int64 SourceSize);
+	static bool DecodeMeshoptIndexSequence(uint8* Destination, const int64 Elements, const int64 Stride, const uint8* Source, const int64 SourceSize);
+	static bool DecodeMeshoptFilter(uint8* Data, const int64 Elements, const int64 Stride, const FString& Filter);
+
 protected:
 
 	bool MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePrimitives, FglTFRuntimePrimitive& OutPrimitive);
@@ -2057,12 +2477,17 @@ protected:
 	FVector ComputeTangentY(const FVector Normal, const FVector TangetX);
 	FVector ComputeTangentYWithW(const FVector Normal, const FVector TangetX, const float W);
 
-	TArray64<uint8> ZeroBuffer;
+	// zero buffers are never reallocated, a bigger one is added when required
+	TArray<TUniquePtr<TArray64<uint8>>> ZeroBuffers;
+	FCriticalSection ZeroBufferLock;
 	TMap<int32, TArray64<uint8>> SparseAccessorsCache;
 	TMap<int32, int64> SparseAccessorsStridesCache;
+	FCriticalSection SparseAccessorsCacheLock;
 
 	TMap<int64, TMap<FString, FglTFRuntimeBlob>> AdditionalBufferViewsCache;
 	TArray<TArray64<uint8>> AdditionalBufferViewsData;
+	// protects AdditionalBufferViewsCache and AdditionalBufferViewsData
+	mutable FCriticalSection AdditionalBufferViewsCacheLock;
 
 	FString DefaultPrefixForUnnamedNodes;
 };
@@ -0,0 +1,73 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
+
+class FQueuedThreadPool;
+
+enum class EglTFRuntimeTaskPriority : uint8
+{
+	High,
+	Normal,
+	Low,
+	Num
+};
+
+struct FglTFRuntimeTask
+{
+	uint64 OwnerId;
+	TFunction<void()> Work;
+	// called (in place of Work) when the task is cancelled before starting
+	TFunction<void()> OnCancelled;
+};
+
+/*
+* Bounded scheduler for async loads: tasks are queued by priority and run on a dedicated thread pool,
+* with at most MaxConcurrency tasks in flight (instead of one OS thread per load).
+* Loads can block (waiting for streamed data or for the game thread), so they never occupy
+* the engine pool threads other tasks (like zip prefetching) depend on.
+* The limit is global, driven by the glTFRuntime.MaxConcurrentAsyncTasks console variable
+* (can be set in the project config, [ConsoleVariables] section of DefaultEngine.ini).
+*/
+class GLTFRUNTIME_API FglTFRuntimeTaskScheduler
+{
+public:
+	static FglTFRuntimeTaskScheduler& Get();
+
+	// unique (never reused) owner id, 0 means no owner (the task cannot be cancelled)
+	static uint64 NewOwnerId();
+
+	void Enqueue(const uint64 OwnerId, TFunction<void()> Work, TFunction<void()> OnCancelled = nullptr, const EglTFRuntimeTaskPriority Priority = EglTFRuntimeTaskPriority::Normal);
+
+	// cancel all of the pending (not yet started) tasks of the specified owner
+	int32 Cancel(const uint64 OwnerId);
+
+	// updates glTFRuntime.MaxConcurrentAsyncTasks, 0 means the number of worker threads (the pool size, that is also the upper limit)
+	void SetMaxConcurrency(const int32 InMaxConcurrency);
+	int32 GetMaxConcurrency() const;
+
+	int32 GetNumPending() const;
+	int32 GetNumRunning() const;
+
+	// called by the module, Shutdown() cancels the pending tasks and waits for the running ones
+	void Startup();
+	void Shutdown();
+
+protected:
+	FglTFRuntimeTaskScheduler();
+
+	// TasksLock must be held, the collected tasks are launched with Launch() after releasing it
+	void Dispatch(TArray<TSharedRef<FglTFRuntimeTask>>& OutTasks);
+	void Launch(const TArray<TSharedRef<FglTFRuntimeTask>>& Tasks);
+	void OnTaskCompleted();
+
+	mutable FCriticalSection TasksLock;
+	TArray<TSharedRef<FglTFRuntimeTask>> PendingTasks[(int32)EglTFRuntimeTaskPriority::Num];
+	int32 NumRunning;
+	// both guarded by TasksLock
+	FQueuedThreadPool* ThreadPool;
+	int32 NumPoolThreads;
+};
@@ -48,6 +48,9 @@ public class glTFRuntime : ModuleRules
             }
             );
 
+        // streaming inflate for zip and gzip archives
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
         if (Target.Type == TargetType.Editor)
         {
             PrivateDependencyModuleNames.Add("SkeletalMeshUtilitiesCommon");